@@ -0,0 +1,440 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <static_math/cmath.h>
+#include <static_math/complex.h>
+#include <static_math/trigonometry.h>
+
+// Measures the accuracy and the runtime throughput of the functions
+// from cmath.h, trigonometry.h and complex.h, for float and double.
+// The errors are measured in ULPs against the standard library
+// functions evaluated with long double. The standard functions for
+// the measured type are measured the same way for comparison.
+//
+// The benchmark is compiled without runtime dispatch so that the
+// constexpr engines are measured. Pass --json to get the results
+// as JSON instead of a table.
+
+namespace
+{
+    constexpr std::size_t samples = 1 << 16;
+    constexpr std::size_t repetitions = 20;
+
+    struct result
+    {
+        const char* name;
+        const char* type;
+        double low;
+        double high;
+        double max_ulp;
+        double mean_ulp;
+        double std_max_ulp;
+        double std_mean_ulp;
+        double ns_per_call;
+        double std_ns_per_call;
+    };
+
+    template<typename T>
+    auto type_name()
+        -> const char*
+    {
+        return std::is_same<T, float>::value ? "float" : "double";
+    }
+
+    // Distance between res and ref in units in the last place of T
+    // at ref; subnormal results use the ULP of the smallest normal
+    template<typename T>
+    auto ulp_error(T res, long double ref)
+        -> double
+    {
+        if (std::isnan(res) && std::isnan(ref)) {
+            return 0.0;
+        }
+        if (static_cast<long double>(res) == ref) {
+            return 0.0;
+        }
+        if (!std::isfinite(res) || !std::isfinite(ref)) {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        int exponent = std::numeric_limits<T>::min_exponent - 1;
+        T rounded_ref = static_cast<T>(ref);
+        if (rounded_ref != 0 && std::isfinite(rounded_ref)) {
+            int ref_exponent = std::ilogb(rounded_ref);
+            if (ref_exponent > exponent) {
+                exponent = ref_exponent;
+            }
+        }
+        long double ulp = std::ldexp(1.0L, exponent - (std::numeric_limits<T>::digits - 1));
+        return static_cast<double>(std::fabs(static_cast<long double>(res) - ref) / ulp);
+    }
+
+    template<typename T>
+    auto make_inputs(double low, double high, std::uint_fast64_t seed)
+        -> std::vector<T>
+    {
+        std::mt19937_64 engine(seed);
+        std::uniform_real_distribution<double> dist(low, high);
+        std::vector<T> res(samples);
+        for (auto& x: res) {
+            x = static_cast<T>(dist(engine));
+        }
+        return res;
+    }
+
+    template<typename T, typename Function>
+    auto ns_per_call(Function func, const std::vector<T>& xs, const std::vector<T>& ys)
+        -> double
+    {
+        using clock_type = std::chrono::steady_clock;
+
+        volatile T sink = 0;
+        auto start = clock_type::now();
+        for (std::size_t i = 0 ; i < repetitions ; ++i) {
+            T acc = 0;
+            for (std::size_t j = 0 ; j < xs.size() ; ++j) {
+                acc += func(xs[j], ys[j]);
+            }
+            sink = sink + acc;
+        }
+        auto end = clock_type::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (repetitions * xs.size());
+    }
+
+    // Measures a function of one or two arguments; ys only matters
+    // for the functions that use their second argument
+    template<typename T, typename SmathFunction, typename StdFunction, typename RefFunction>
+    auto measure(std::vector<result>& results, const char* name,
+                 double low, double high, double y_low, double y_high,
+                 SmathFunction smath_func, StdFunction std_func, RefFunction ref_func)
+        -> void
+    {
+        auto xs = make_inputs<T>(low, high, 0x5eed);
+        auto ys = make_inputs<T>(y_low, y_high, 0xc0ffee);
+
+        double max_ulp = 0.0;
+        double sum_ulp = 0.0;
+        double std_max_ulp = 0.0;
+        double std_sum_ulp = 0.0;
+        for (std::size_t i = 0 ; i < xs.size() ; ++i) {
+            long double ref = ref_func(static_cast<long double>(xs[i]),
+                                       static_cast<long double>(ys[i]));
+            double err = ulp_error<T>(smath_func(xs[i], ys[i]), ref);
+            double std_err = ulp_error<T>(std_func(xs[i], ys[i]), ref);
+            if (err > max_ulp) max_ulp = err;
+            if (std_err > std_max_ulp) std_max_ulp = std_err;
+            sum_ulp += err;
+            std_sum_ulp += std_err;
+        }
+
+        results.push_back({
+            name, type_name<T>(), low, high,
+            max_ulp, sum_ulp / xs.size(),
+            std_max_ulp, std_sum_ulp / xs.size(),
+            ns_per_call<T>(smath_func, xs, ys),
+            ns_per_call<T>(std_func, xs, ys)
+        });
+    }
+
+    template<typename T, typename SmathFunction, typename StdFunction, typename RefFunction>
+    auto measure_unary(std::vector<result>& results, const char* name, double low, double high,
+                       SmathFunction smath_func, StdFunction std_func, RefFunction ref_func)
+        -> void
+    {
+        measure<T>(results, name, low, high, 0.0, 0.0,
+                   [=](T x, T) { return smath_func(x); },
+                   [=](T x, T) { return std_func(x); },
+                   [=](long double x, long double) { return ref_func(x); });
+    }
+
+    template<typename T>
+    auto measure_all(std::vector<result>& results)
+        -> void
+    {
+        using ld = long double;
+
+        ////////////////////////////////////////////////////////////
+        // cmath.h
+
+        measure_unary<T>(results, "floor", -1e6, 1e6,
+                         [](T x) { return smath::floor(x); },
+                         [](T x) { return std::floor(x); },
+                         [](ld x) { return std::floor(x); });
+        measure_unary<T>(results, "ceil", -1e6, 1e6,
+                         [](T x) { return smath::ceil(x); },
+                         [](T x) { return std::ceil(x); },
+                         [](ld x) { return std::ceil(x); });
+        measure_unary<T>(results, "round", -1e6, 1e6,
+                         [](T x) { return smath::round(x); },
+                         [](T x) { return std::round(x); },
+                         [](ld x) { return std::round(x); });
+        measure_unary<T>(results, "trunc", -1e6, 1e6,
+                         [](T x) { return smath::trunc(x); },
+                         [](T x) { return std::trunc(x); },
+                         [](ld x) { return std::trunc(x); });
+        measure_unary<T>(results, "exp", -80.0, 80.0,
+                         [](T x) { return smath::exp(x); },
+                         [](T x) { return std::exp(x); },
+                         [](ld x) { return std::exp(x); });
+        measure_unary<T>(results, "exp2", -100.0, 100.0,
+                         [](T x) { return smath::exp2(x); },
+                         [](T x) { return std::exp2(x); },
+                         [](ld x) { return std::exp2(x); });
+        measure_unary<T>(results, "exp10", -30.0, 30.0,
+                         [](T x) { return smath::exp10(x); },
+                         [](T x) { return std::pow(T(10), x); },
+                         [](ld x) { return std::pow(10.0L, x); });
+        measure_unary<T>(results, "expm1", -2.0, 2.0,
+                         [](T x) { return smath::expm1(x); },
+                         [](T x) { return std::expm1(x); },
+                         [](ld x) { return std::expm1(x); });
+        measure_unary<T>(results, "log", 1e-6, 1e6,
+                         [](T x) { return smath::log(x); },
+                         [](T x) { return std::log(x); },
+                         [](ld x) { return std::log(x); });
+        measure_unary<T>(results, "log1p", -0.5, 2.0,
+                         [](T x) { return smath::log1p(x); },
+                         [](T x) { return std::log1p(x); },
+                         [](ld x) { return std::log1p(x); });
+        measure_unary<T>(results, "log2", 1e-6, 1e6,
+                         [](T x) { return smath::log2(x); },
+                         [](T x) { return std::log2(x); },
+                         [](ld x) { return std::log2(x); });
+        measure_unary<T>(results, "log10", 1e-6, 1e6,
+                         [](T x) { return smath::log10(x); },
+                         [](T x) { return std::log10(x); },
+                         [](ld x) { return std::log10(x); });
+        measure_unary<T>(results, "sqrt", 0.0, 1e6,
+                         [](T x) { return smath::sqrt(x); },
+                         [](T x) { return std::sqrt(x); },
+                         [](ld x) { return std::sqrt(x); });
+        measure_unary<T>(results, "pow", -100.0, 100.0,
+                         [](T x) { return smath::pow(x, 7); },
+                         [](T x) { return std::pow(x, T(7)); },
+                         [](ld x) { return std::pow(x, 7.0L); });
+        measure<T>(results, "pow_real", 0.01, 10.0, -10.0, 10.0,
+                   [](T x, T y) { return smath::pow(x, y); },
+                   [](T x, T y) { return std::pow(x, y); },
+                   [](ld x, ld y) { return std::pow(x, y); });
+        measure_unary<T>(results, "pow_gamma", 0.0, 1.0,
+                         [](T x) { return smath::pow(x, T(2.4)); },
+                         [](T x) { return std::pow(x, T(2.4)); },
+                         [](ld x) { return std::pow(x, static_cast<ld>(T(2.4))); });
+        measure_unary<T>(results, "cbrt", -1e6, 1e6,
+                         [](T x) { return smath::cbrt(x); },
+                         [](T x) { return std::cbrt(x); },
+                         [](ld x) { return std::cbrt(x); });
+        measure<T>(results, "hypot", -1e3, 1e3, -1e3, 1e3,
+                   [](T x, T y) { return smath::hypot(x, y); },
+                   [](T x, T y) { return std::hypot(x, y); },
+                   [](ld x, ld y) { return std::hypot(x, y); });
+        measure_unary<T>(results, "sin", -10.0, 10.0,
+                         [](T x) { return smath::sin(x); },
+                         [](T x) { return std::sin(x); },
+                         [](ld x) { return std::sin(x); });
+        measure_unary<T>(results, "cos", -10.0, 10.0,
+                         [](T x) { return smath::cos(x); },
+                         [](T x) { return std::cos(x); },
+                         [](ld x) { return std::cos(x); });
+        measure_unary<T>(results, "tan", -1.5, 1.5,
+                         [](T x) { return smath::tan(x); },
+                         [](T x) { return std::tan(x); },
+                         [](ld x) { return std::tan(x); });
+        measure_unary<T>(results, "asin", -1.0, 1.0,
+                         [](T x) { return smath::asin(x); },
+                         [](T x) { return std::asin(x); },
+                         [](ld x) { return std::asin(x); });
+        measure_unary<T>(results, "acos", -1.0, 1.0,
+                         [](T x) { return smath::acos(x); },
+                         [](T x) { return std::acos(x); },
+                         [](ld x) { return std::acos(x); });
+        measure_unary<T>(results, "atan", -10.0, 10.0,
+                         [](T x) { return smath::atan(x); },
+                         [](T x) { return std::atan(x); },
+                         [](ld x) { return std::atan(x); });
+        measure<T>(results, "atan2", -10.0, 10.0, -10.0, 10.0,
+                   [](T x, T y) { return smath::atan2(y, x); },
+                   [](T x, T y) { return std::atan2(y, x); },
+                   [](ld x, ld y) { return std::atan2(y, x); });
+        measure_unary<T>(results, "sinh", -40.0, 40.0,
+                         [](T x) { return smath::sinh(x); },
+                         [](T x) { return std::sinh(x); },
+                         [](ld x) { return std::sinh(x); });
+        measure_unary<T>(results, "cosh", -40.0, 40.0,
+                         [](T x) { return smath::cosh(x); },
+                         [](T x) { return std::cosh(x); },
+                         [](ld x) { return std::cosh(x); });
+        measure_unary<T>(results, "tanh", -40.0, 40.0,
+                         [](T x) { return smath::tanh(x); },
+                         [](T x) { return std::tanh(x); },
+                         [](ld x) { return std::tanh(x); });
+        measure_unary<T>(results, "erf", -5.0, 5.0,
+                         [](T x) { return smath::erf(x); },
+                         [](T x) { return std::erf(x); },
+                         [](ld x) { return std::erf(x); });
+        measure_unary<T>(results, "erfc", -5.0, 9.0,
+                         [](T x) { return smath::erfc(x); },
+                         [](T x) { return std::erfc(x); },
+                         [](ld x) { return std::erfc(x); });
+        measure_unary<T>(results, "tgamma", -30.0, 30.0,
+                         [](T x) { return smath::tgamma(x); },
+                         [](T x) { return std::tgamma(x); },
+                         [](ld x) { return std::tgamma(x); });
+        measure_unary<T>(results, "lgamma", 0.0, 1000.0,
+                         [](T x) { return smath::lgamma(x); },
+                         [](T x) { return std::lgamma(x); },
+                         [](ld x) { return std::lgamma(x); });
+
+        ////////////////////////////////////////////////////////////
+        // trigonometry.h
+
+        measure_unary<T>(results, "cot", 0.1, 3.0,
+                         [](T x) { return smath::cot(x); },
+                         [](T x) { return 1 / std::tan(x); },
+                         [](ld x) { return 1 / std::tan(x); });
+        measure_unary<T>(results, "sec", -1.5, 1.5,
+                         [](T x) { return smath::sec(x); },
+                         [](T x) { return 1 / std::cos(x); },
+                         [](ld x) { return 1 / std::cos(x); });
+        measure_unary<T>(results, "csc", 0.1, 3.0,
+                         [](T x) { return smath::csc(x); },
+                         [](T x) { return 1 / std::sin(x); },
+                         [](ld x) { return 1 / std::sin(x); });
+        measure_unary<T>(results, "coth", 0.1, 10.0,
+                         [](T x) { return smath::coth(x); },
+                         [](T x) { return 1 / std::tanh(x); },
+                         [](ld x) { return 1 / std::tanh(x); });
+        measure_unary<T>(results, "sech", -10.0, 10.0,
+                         [](T x) { return smath::sech(x); },
+                         [](T x) { return 1 / std::cosh(x); },
+                         [](ld x) { return 1 / std::cosh(x); });
+        measure_unary<T>(results, "csch", 0.1, 10.0,
+                         [](T x) { return smath::csch(x); },
+                         [](T x) { return 1 / std::sinh(x); },
+                         [](ld x) { return 1 / std::sinh(x); });
+
+        ////////////////////////////////////////////////////////////
+        // complex.h
+
+        measure<T>(results, "abs(complex)", -1e3, 1e3, -1e3, 1e3,
+                   [](T x, T y) { return smath::abs(smath::complex<T>(x, y)); },
+                   [](T x, T y) { return std::abs(std::complex<T>(x, y)); },
+                   [](ld x, ld y) { return std::abs(std::complex<ld>(x, y)); });
+        measure<T>(results, "norm(complex)", -1e3, 1e3, -1e3, 1e3,
+                   [](T x, T y) { return smath::norm(smath::complex<T>(x, y)); },
+                   [](T x, T y) { return std::norm(std::complex<T>(x, y)); },
+                   [](ld x, ld y) { return std::norm(std::complex<ld>(x, y)); });
+        measure<T>(results, "arg(complex)", -1e3, 1e3, -1e3, 1e3,
+                   [](T x, T y) { return smath::arg(smath::complex<T>(x, y)); },
+                   [](T x, T y) { return std::arg(std::complex<T>(x, y)); },
+                   [](ld x, ld y) { return std::arg(std::complex<ld>(x, y)); });
+        measure<T>(results, "polar.real", 0.0, 1e3, -10.0, 10.0,
+                   [](T x, T y) { return smath::polar(x, y).real; },
+                   [](T x, T y) { return std::polar(x, y).real(); },
+                   [](ld x, ld y) { return std::polar(x, y).real(); });
+        measure<T>(results, "polar.imag", 0.0, 1e3, -10.0, 10.0,
+                   [](T x, T y) { return smath::polar(x, y).imag.value; },
+                   [](T x, T y) { return std::polar(x, y).imag(); },
+                   [](ld x, ld y) { return std::polar(x, y).imag(); });
+    }
+
+    auto print_number(double value)
+        -> void
+    {
+        // JSON has no representation for infinities
+        if (std::isfinite(value)) {
+            std::printf("%.17g", value);
+        } else {
+            std::printf("null");
+        }
+    }
+
+    auto print_json(const std::vector<result>& results)
+        -> void
+    {
+        std::printf("{\n  \"results\": [\n");
+        for (std::size_t i = 0 ; i < results.size() ; ++i) {
+            const result& res = results[i];
+            std::printf("    {\"function\": \"%s\", \"type\": \"%s\", \"low\": ", res.name, res.type);
+            print_number(res.low);
+            std::printf(", \"high\": ");
+            print_number(res.high);
+            std::printf(", \"samples\": %zu, \"max_ulp\": ", samples);
+            print_number(res.max_ulp);
+            std::printf(", \"mean_ulp\": ");
+            print_number(res.mean_ulp);
+            std::printf(", \"std_max_ulp\": ");
+            print_number(res.std_max_ulp);
+            std::printf(", \"std_mean_ulp\": ");
+            print_number(res.std_mean_ulp);
+            std::printf(", \"ns_per_call\": ");
+            print_number(res.ns_per_call);
+            std::printf(", \"calls_per_second\": ");
+            print_number(1e9 / res.ns_per_call);
+            std::printf(", \"std_ns_per_call\": ");
+            print_number(res.std_ns_per_call);
+            std::printf("}%s\n", i + 1 < results.size() ? "," : "");
+        }
+        std::printf("  ]\n}\n");
+    }
+
+    auto print_table(const std::vector<result>& results)
+        -> void
+    {
+        std::printf("%-14s %-6s %10s %10s %10s %10s %9s %12s %9s\n",
+                    "function", "type", "max ulp", "mean ulp", "std max", "std mean",
+                    "ns/call", "calls/s", "std ns");
+        for (const result& res: results) {
+            std::printf("%-14s %-6s %10.3g %10.3g %10.3g %10.3g %9.2f %12.4g %9.2f\n",
+                        res.name, res.type, res.max_ulp, res.mean_ulp,
+                        res.std_max_ulp, res.std_mean_ulp,
+                        res.ns_per_call, 1e9 / res.ns_per_call, res.std_ns_per_call);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<result> results;
+    measure_all<float>(results);
+    measure_all<double>(results);
+
+    if (argc > 1 && std::strcmp(argv[1], "--json") == 0) {
+        print_json(results);
+    } else {
+        print_table(results);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <static_math/batch.h>
+
+// Measures the throughput of the functions from batch.h, in both
+// fast and strict modes, against a loop over the standard library
+// functions
+
+namespace
+{
+    template<typename Function>
+    auto ns_per_element(Function func, const std::vector<double>& inputs)
+        -> double
+    {
+        using clock_type = std::chrono::steady_clock;
+        constexpr std::size_t repetitions = 200;
+
+        std::vector<double> outputs(inputs.size());
+        volatile double sink = 0.0;
+        auto start = clock_type::now();
+        for (std::size_t i = 0 ; i < repetitions ; ++i) {
+            func(inputs.data(), inputs.data() + inputs.size(), outputs.data());
+            sink = sink + outputs[i % outputs.size()];
+        }
+        auto end = clock_type::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (repetitions * inputs.size());
+    }
+
+    auto make_inputs(double low, double high)
+        -> std::vector<double>
+    {
+        std::mt19937_64 engine(0x5eed);
+        std::uniform_real_distribution<double> dist(low, high);
+        std::vector<double> res(1 << 14);
+        for (auto& x: res) {
+            x = dist(engine);
+        }
+        return res;
+    }
+
+    template<typename FastFunction, typename StrictFunction, typename StdFunction>
+    auto compare(const char* name, double low, double high, FastFunction fast_func,
+                 StrictFunction strict_func, StdFunction std_func)
+        -> void
+    {
+        auto inputs = make_inputs(low, high);
+        double fast_ns = ns_per_element(fast_func, inputs);
+        double strict_ns = ns_per_element(strict_func, inputs);
+        double std_ns = ns_per_element([&](const double* first, const double* last, double* out) {
+            for (; first != last ; ++first, ++out) {
+                *out = std_func(*first);
+            }
+        }, inputs);
+        std::printf("%-6s [%8g, %8g]  fast: %6.2f ns  strict: %6.2f ns  std loop: %6.2f ns  speedup: %5.2fx\n",
+                    name, low, high, fast_ns, strict_ns, std_ns, std_ns / fast_ns);
+    }
+}
+
+int main()
+{
+#ifdef STATIC_MATH_HAS_BATCH_SIMD
+    const char* isa_names[] = { "none", "SSE2", "AVX2", "AVX-512" };
+    std::printf("instruction set: %s\n",
+                isa_names[static_cast<int>(smath::detail::current_simd_isa())]);
+#else
+    std::printf("instruction set: scalar\n");
+#endif
+
+    compare("sin", -3.0, 3.0,
+            [](const double* first, const double* last, double* out) { smath::batch::sin(first, last, out); },
+            [](const double* first, const double* last, double* out) { smath::batch::sin(smath::batch::strict, first, last, out); },
+            [](double x) { return std::sin(x); });
+    compare("cos", -3.0, 3.0,
+            [](const double* first, const double* last, double* out) { smath::batch::cos(first, last, out); },
+            [](const double* first, const double* last, double* out) { smath::batch::cos(smath::batch::strict, first, last, out); },
+            [](double x) { return std::cos(x); });
+    compare("exp", -10.0, 10.0,
+            [](const double* first, const double* last, double* out) { smath::batch::exp(first, last, out); },
+            [](const double* first, const double* last, double* out) { smath::batch::exp(smath::batch::strict, first, last, out); },
+            [](double x) { return std::exp(x); });
+    compare("log", 0.01, 100.0,
+            [](const double* first, const double* last, double* out) { smath::batch::log(first, last, out); },
+            [](const double* first, const double* last, double* out) { smath::batch::log(smath::batch::strict, first, last, out); },
+            [](double x) { return std::log(x); });
+    compare("sqrt", 0.0, 1.0e6,
+            [](const double* first, const double* last, double* out) { smath::batch::sqrt(first, last, out); },
+            [](const double* first, const double* last, double* out) { smath::batch::sqrt(smath::batch::strict, first, last, out); },
+            [](double x) { return std::sqrt(x); });
+    compare("hypot", -1.0e3, 1.0e3,
+            [](const double* first, const double* last, double* out) { smath::batch::hypot(first, last, first, out); },
+            [](const double* first, const double* last, double* out) { smath::batch::hypot(smath::batch::strict, first, last, first, out); },
+            [](double x) { return std::hypot(x, x); });
+}
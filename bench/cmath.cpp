@@ -0,0 +1,175 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <static_math/cmath.h>
+
+// Measures the runtime throughput of the functions from cmath.h
+// against their standard library counterparts. Build the benchmark
+// with and without STATIC_MATH_RUNTIME_DISPATCH to compare the
+// constexpr engines with the runtime dispatch.
+
+namespace
+{
+    template<typename Function>
+    auto ns_per_call(Function func, const std::vector<double>& inputs)
+        -> double
+    {
+        using clock_type = std::chrono::steady_clock;
+        constexpr std::size_t repetitions = 20;
+
+        volatile double sink = 0.0;
+        auto start = clock_type::now();
+        for (std::size_t i = 0 ; i < repetitions ; ++i) {
+            double acc = 0.0;
+            for (double x: inputs) {
+                acc += func(x);
+            }
+            sink = sink + acc;
+        }
+        auto end = clock_type::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (repetitions * inputs.size());
+    }
+
+    auto make_inputs(double low, double high)
+        -> std::vector<double>
+    {
+        std::mt19937_64 engine(0x5eed);
+        std::uniform_real_distribution<double> dist(low, high);
+        std::vector<double> res(1 << 14);
+        for (auto& x: res) {
+            x = dist(engine);
+        }
+        return res;
+    }
+
+    template<typename SmathFunction, typename StdFunction>
+    auto compare(const char* name, double low, double high,
+                 SmathFunction smath_func, StdFunction std_func)
+        -> void
+    {
+        auto inputs = make_inputs(low, high);
+        double smath_ns = ns_per_call(smath_func, inputs);
+        double std_ns = ns_per_call(std_func, inputs);
+        std::printf("%-8s [%8g, %8g]  smath: %9.2f ns  std: %7.2f ns  ratio: %7.2fx\n",
+                    name, low, high, smath_ns, std_ns, smath_ns / std_ns);
+    }
+}
+
+int main()
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    std::printf("runtime dispatch: enabled\n");
+#else
+    std::printf("runtime dispatch: disabled\n");
+#endif
+
+    compare("floor", -1.0e12, 1.0e12,
+            [](double x) { return smath::floor(x); },
+            [](double x) { return std::floor(x); });
+    compare("round", -1.0e12, 1.0e12,
+            [](double x) { return smath::round(x); },
+            [](double x) { return std::round(x); });
+    compare("fmod", -1.0e3, 1.0e3,
+            [](double x) { return smath::fmod(x, 0.7); },
+            [](double x) { return std::fmod(x, 0.7); });
+    compare("sin", -3.0, 3.0,
+            [](double x) { return smath::sin(x); },
+            [](double x) { return std::sin(x); });
+    compare("cos", -3.0, 3.0,
+            [](double x) { return smath::cos(x); },
+            [](double x) { return std::cos(x); });
+    compare("sincos", -3.0, 3.0,
+            [](double x) { auto res = smath::sincos(x); return res.sin + res.cos; },
+            [](double x) { return std::sin(x) + std::cos(x); });
+    compare("tan", -1.5, 1.5,
+            [](double x) { return smath::tan(x); },
+            [](double x) { return std::tan(x); });
+    compare("sinh", -5.0, 5.0,
+            [](double x) { return smath::sinh(x); },
+            [](double x) { return std::sinh(x); });
+    compare("cosh", -5.0, 5.0,
+            [](double x) { return smath::cosh(x); },
+            [](double x) { return std::cosh(x); });
+    compare("sinhcosh", -5.0, 5.0,
+            [](double x) { auto res = smath::sinhcosh(x); return res.sinh + res.cosh; },
+            [](double x) { return std::sinh(x) + std::cosh(x); });
+    compare("tanh", -5.0, 5.0,
+            [](double x) { return smath::tanh(x); },
+            [](double x) { return std::tanh(x); });
+    compare("exp", -10.0, 10.0,
+            [](double x) { return smath::exp(x); },
+            [](double x) { return std::exp(x); });
+    compare("exp2", -10.0, 10.0,
+            [](double x) { return smath::exp2(x); },
+            [](double x) { return std::exp2(x); });
+    compare("exp10", -10.0, 10.0,
+            [](double x) { return smath::exp10(x); },
+            [](double x) { return std::pow(10.0, x); });
+    compare("expm1", -1.0, 1.0,
+            [](double x) { return smath::expm1(x); },
+            [](double x) { return std::expm1(x); });
+    compare("log", 0.01, 100.0,
+            [](double x) { return smath::log(x); },
+            [](double x) { return std::log(x); });
+    compare("log1p", -0.5, 2.0,
+            [](double x) { return smath::log1p(x); },
+            [](double x) { return std::log1p(x); });
+    compare("log2", 0.01, 100.0,
+            [](double x) { return smath::log2(x); },
+            [](double x) { return std::log2(x); });
+    compare("log10", 0.01, 100.0,
+            [](double x) { return smath::log10(x); },
+            [](double x) { return std::log10(x); });
+    compare("sqrt", 0.0, 1.0e6,
+            [](double x) { return smath::sqrt(x); },
+            [](double x) { return std::sqrt(x); });
+    compare("pow", 0.0, 1.0,
+            [](double x) { return smath::pow(x, 2.4); },
+            [](double x) { return std::pow(x, 2.4); });
+    compare("cbrt", -1.0e6, 1.0e6,
+            [](double x) { return smath::cbrt(x); },
+            [](double x) { return std::cbrt(x); });
+    compare("erf", -5.0, 5.0,
+            [](double x) { return smath::erf(x); },
+            [](double x) { return std::erf(x); });
+    compare("erfc", -5.0, 25.0,
+            [](double x) { return smath::erfc(x); },
+            [](double x) { return std::erfc(x); });
+    compare("tgamma", -30.0, 30.0,
+            [](double x) { return smath::tgamma(x); },
+            [](double x) { return std::tgamma(x); });
+    compare("lgamma", 0.0, 1000.0,
+            [](double x) { return smath::lgamma(x); },
+            [](double x) { return std::lgamma(x); });
+    compare("hypot", -1.0e3, 1.0e3,
+            [](double x) { return smath::hypot(x, 3.0); },
+            [](double x) { return std::hypot(x, 3.0); });
+}
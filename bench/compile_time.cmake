@@ -0,0 +1,246 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2019 Morwenn
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+# Measures the compile-time cost of the functions from cmath.h.
+#
+# Translation units with an increasing number of smath calls evaluated
+# in constant expressions are generated and compiled; for each of them
+# the script reports the wall time, the peak memory and the number of
+# template instantiations, as well as the cost per call relative to
+# the translation unit that only includes the header.
+#
+# Usage:
+#   cmake -DCXX_COMPILER=<path> -DCXX_COMPILER_ID=<GNU|Clang|AppleClang>
+#         -DINCLUDE_DIR=<path> -DOUTPUT_DIR=<path>
+#         [-DCXX_STANDARD=14] [-DCALL_COUNTS="0;16;64;256"] [-DREPETITIONS=3]
+#         -P compile_time.cmake
+#
+# The peak memory is the maximum resident set size when GNU time is
+# available, and the memory allocated by GCC's garbage collector as
+# reported by -ftime-report otherwise. The template instantiations are
+# counted from the trace generated by Clang's -ftime-trace and are not
+# available with GCC, which only reports the time spent instantiating
+# templates. The results are printed as a table and written as JSON to
+# OUTPUT_DIR/compile_time.json.
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(var CXX_COMPILER CXX_COMPILER_ID INCLUDE_DIR OUTPUT_DIR)
+    if (NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} must be defined")
+    endif()
+endforeach()
+if (NOT DEFINED CXX_STANDARD)
+    set(CXX_STANDARD 14)
+endif()
+if (NOT DEFINED CALL_COUNTS)
+    set(CALL_COUNTS 0 16 64 256)
+endif()
+if (NOT DEFINED REPETITIONS)
+    set(REPETITIONS 3)
+endif()
+
+if (CXX_COMPILER_ID STREQUAL "GNU")
+    set(is_clang FALSE)
+    set(trace_flags -ftime-report)
+elseif (CXX_COMPILER_ID MATCHES "Clang")
+    set(is_clang TRUE)
+    set(trace_flags -ftime-trace -ftime-trace-granularity=0)
+else()
+    message(FATAL_ERROR "The compile-time benchmark only supports GCC and Clang")
+endif()
+
+find_program(TIME_PROGRAM NAMES time PATHS /usr/bin NO_DEFAULT_PATH)
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+# Function and argument type of every call, used in a round-robin fashion
+set(functions sin cos tan exp log log2 sqrt sinh cosh tanh)
+set(types float double)
+
+# Formats a value given in thousandths as a decimal number
+function(format_thousandths out value)
+    if (value LESS 0)
+        set(sign "-")
+        math(EXPR value "-(${value})")
+    else()
+        set(sign "")
+    endif()
+    math(EXPR int_part "${value} / 1000")
+    math(EXPR frac_part "${value} % 1000")
+    string(LENGTH "${frac_part}" frac_length)
+    while (frac_length LESS 3)
+        set(frac_part "0${frac_part}")
+        string(LENGTH "${frac_part}" frac_length)
+    endwhile()
+    set(${out} "${sign}${int_part}.${frac_part}" PARENT_SCOPE)
+endfunction()
+
+# Converts a number of kilobytes such as "19M" or "1876k" from GCC's
+# -ftime-report to a number of kilobytes
+function(parse_ggc_size out value)
+    string(REGEX MATCH "^([0-9]+)([kMG]?)$" _ "${value}")
+    set(size "${CMAKE_MATCH_1}")
+    if (CMAKE_MATCH_2 STREQUAL "M")
+        math(EXPR size "${size} * 1024")
+    elseif (CMAKE_MATCH_2 STREQUAL "G")
+        math(EXPR size "${size} * 1024 * 1024")
+    elseif (CMAKE_MATCH_2 STREQUAL "")
+        math(EXPR size "${size} / 1024")
+    endif()
+    set(${out} "${size}" PARENT_SCOPE)
+endfunction()
+
+# Writes a translation unit with the given number of constexpr calls
+function(generate_source path call_count)
+    list(LENGTH functions function_count)
+    list(LENGTH types type_count)
+    set(content "#include <static_math/cmath.h>\n\n")
+    if (call_count GREATER 0)
+        math(EXPR last "${call_count} - 1")
+        foreach(i RANGE ${last})
+            math(EXPR function_index "${i} % ${function_count}")
+            math(EXPR type_index "(${i} / ${function_count}) % ${type_count}")
+            list(GET functions ${function_index} func)
+            list(GET types ${type_index} type)
+            # Distinct arguments in (0, 1] so that no call can be folded
+            # into another one and every function is in its domain
+            math(EXPR numerator "${i} % 997 + 1")
+            string(APPEND content
+                "constexpr ${type} value_${i} = smath::${func}(static_cast<${type}>(${numerator}) / 997);\n")
+        endforeach()
+    endif()
+    file(WRITE "${path}" "${content}")
+endfunction()
+
+set(json_entries "")
+set(table "calls      wall ms   memory kB  instantiations  instantiation ms  ms/call  inst/call\n")
+
+foreach(call_count IN LISTS CALL_COUNTS)
+    set(source "${OUTPUT_DIR}/compile_time_${call_count}.cpp")
+    set(object "${OUTPUT_DIR}/compile_time_${call_count}.o")
+    generate_source("${source}" ${call_count})
+
+    set(command "${CXX_COMPILER}" -std=c++${CXX_STANDARD} "-I${INCLUDE_DIR}"
+                ${trace_flags} -c "${source}" -o "${object}")
+    if (TIME_PROGRAM)
+        set(command "${TIME_PROGRAM}" -f "peak-rss-kb: %M" ${command})
+    endif()
+
+    # Keep the fastest of several compilations to reduce the noise
+    set(best_wall_us "")
+    foreach(repetition RANGE 1 ${REPETITIONS})
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND ${command}
+            RESULT_VARIABLE result
+            OUTPUT_VARIABLE output
+            ERROR_VARIABLE errors
+        )
+        string(TIMESTAMP end "%s%f")
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Compilation of ${source} failed:\n${errors}")
+        endif()
+        math(EXPR wall_us "${end} - ${start}")
+        if (best_wall_us STREQUAL "" OR wall_us LESS best_wall_us)
+            set(best_wall_us ${wall_us})
+        endif()
+    endforeach()
+
+    # Peak memory and instantiation time from the last compilation
+    set(memory_kb "null")
+    set(instantiation_us "null")
+    set(instantiations "null")
+    if (errors MATCHES "peak-rss-kb: ([0-9]+)")
+        set(memory_kb "${CMAKE_MATCH_1}")
+    endif()
+    if (is_clang)
+        string(REGEX REPLACE "\\.o$" ".json" trace "${object}")
+        file(READ "${trace}" trace_content)
+        string(REGEX MATCHALL "\"name\":\"Instantiate(Function|Class)\"" events "${trace_content}")
+        list(LENGTH events instantiations)
+        set(instantiation_us 0)
+        foreach(kind Function Class)
+            if (trace_content MATCHES "\"dur\":([0-9]+),\"name\":\"Total Instantiate${kind}\"")
+                math(EXPR instantiation_us "${instantiation_us} + ${CMAKE_MATCH_1}")
+            endif()
+        endforeach()
+    else()
+        if (errors MATCHES "template instantiation +: +[0-9.]+ \\([ 0-9]+%\\) +[0-9.]+ \\([ 0-9]+%\\) +([0-9]+)\\.([0-9]+)")
+            math(EXPR instantiation_us "${CMAKE_MATCH_1} * 1000000 + ${CMAKE_MATCH_2} * 10000")
+        else()
+            set(instantiation_us 0)
+        endif()
+        if (memory_kb STREQUAL "null" AND errors MATCHES "TOTAL +:[ 0-9.]+ +([0-9]+[kMG]?)")
+            parse_ggc_size(memory_kb "${CMAKE_MATCH_1}")
+        endif()
+    endif()
+
+    # Cost per call relative to the first translation unit
+    if (NOT DEFINED base_wall_us)
+        set(base_call_count ${call_count})
+        set(base_wall_us ${best_wall_us})
+        set(base_instantiations ${instantiations})
+    endif()
+    set(ms_per_call "null")
+    set(instantiations_per_call "null")
+    math(EXPR extra_calls "${call_count} - ${base_call_count}")
+    if (extra_calls GREATER 0)
+        math(EXPR value "(${best_wall_us} - ${base_wall_us}) / ${extra_calls}")
+        format_thousandths(ms_per_call ${value})
+        if (NOT instantiations STREQUAL "null")
+            math(EXPR value "(${instantiations} - ${base_instantiations}) * 1000 / ${extra_calls}")
+            format_thousandths(instantiations_per_call ${value})
+        endif()
+    endif()
+
+    math(EXPR wall_thousandths "${best_wall_us}")
+    format_thousandths(wall_ms ${wall_thousandths})
+    set(instantiation_ms "null")
+    if (NOT instantiation_us STREQUAL "null")
+        format_thousandths(instantiation_ms ${instantiation_us})
+    endif()
+
+    list(APPEND json_entries
+        "    {\"calls\": ${call_count}, \"wall_ms\": ${wall_ms}, \"peak_memory_kb\": ${memory_kb}, \"instantiations\": ${instantiations}, \"instantiation_ms\": ${instantiation_ms}, \"ms_per_call\": ${ms_per_call}, \"instantiations_per_call\": ${instantiations_per_call}}")
+
+    set(line "")
+    foreach(pair "${call_count};5" "${wall_ms};12" "${memory_kb};12" "${instantiations};16"
+                 "${instantiation_ms};18" "${ms_per_call};9" "${instantiations_per_call};11")
+        list(GET pair 0 value)
+        list(GET pair 1 width)
+        string(LENGTH "${value}" length)
+        while (length LESS width)
+            set(value " ${value}")
+            math(EXPR length "${length} + 1")
+        endwhile()
+        string(APPEND line "${value}")
+    endforeach()
+    string(APPEND table "${line}\n")
+endforeach()
+
+string(REPLACE ";" ",\n" json_entries "${json_entries}")
+file(WRITE "${OUTPUT_DIR}/compile_time.json"
+    "{\n  \"compiler\": \"${CXX_COMPILER_ID}\",\n  \"standard\": ${CXX_STANDARD},\n  \"results\": [\n${json_entries}\n  ]\n}\n")
+
+message("${table}")
+message("Results written to ${OUTPUT_DIR}/compile_time.json")
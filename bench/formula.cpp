@@ -0,0 +1,116 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+#include <static_math/formula.h>
+
+// Measures the runtime throughput of smath::gcd with Euclid's
+// algorithm and with Stein's binary algorithm, for operands of
+// different widths
+
+namespace
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+#endif
+
+    template<typename Unsigned, typename Function>
+    auto ns_per_call(Function func, const std::vector<std::pair<Unsigned, Unsigned>>& inputs)
+        -> double
+    {
+        using clock_type = std::chrono::steady_clock;
+        constexpr std::size_t repetitions = 20;
+
+        volatile Unsigned sink = 0;
+        auto start = clock_type::now();
+        for (std::size_t i = 0 ; i < repetitions ; ++i) {
+            Unsigned acc = 0;
+            for (const auto& operands: inputs) {
+                acc += func(operands.first, operands.second);
+            }
+            sink = sink + acc;
+        }
+        auto end = clock_type::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (repetitions * inputs.size());
+    }
+
+    // Random operands sharing a random common factor, so that the
+    // results are not almost always 1
+    template<typename Unsigned>
+    auto make_inputs()
+        -> std::vector<std::pair<Unsigned, Unsigned>>
+    {
+        constexpr int digits = std::numeric_limits<Unsigned>::digits;
+
+        std::mt19937_64 engine(0x5eed);
+        // Odd random number of the given number of bits
+        auto random = [&engine](int bits) {
+            Unsigned res = 0;
+            for (int i = 0 ; i < bits ; i += 32) {
+                res = static_cast<Unsigned>(res << 16 << 16) | static_cast<Unsigned>(engine() & 0xffffffffu);
+            }
+            const Unsigned mask = static_cast<Unsigned>((Unsigned(1) << bits) - 1u);
+            return static_cast<Unsigned>((res & mask) | 1u);
+        };
+
+        std::vector<std::pair<Unsigned, Unsigned>> res(1 << 12);
+        for (auto& operands: res) {
+            Unsigned factor = random(digits / 4);
+            operands.first = static_cast<Unsigned>(factor * random(digits / 2) << (engine() % 8));
+            operands.second = static_cast<Unsigned>(factor * random(digits / 2) << (engine() % 8));
+        }
+        return res;
+    }
+
+    template<typename Unsigned>
+    auto compare(const char* name)
+        -> void
+    {
+        auto inputs = make_inputs<Unsigned>();
+        double euclid_ns = ns_per_call<Unsigned>([](Unsigned a, Unsigned b) {
+            return smath::gcd(smath::euclidean_gcd, a, b);
+        }, inputs);
+        double binary_ns = ns_per_call<Unsigned>([](Unsigned a, Unsigned b) {
+            return smath::gcd(smath::binary_gcd, a, b);
+        }, inputs);
+        std::printf("gcd %-8s  euclid: %8.2f ns  binary: %8.2f ns  speedup: %5.2fx\n",
+                    name, euclid_ns, binary_ns, euclid_ns / binary_ns);
+    }
+}
+
+int main()
+{
+    compare<std::uint32_t>("32-bit");
+    compare<std::uint64_t>("64-bit");
+#if defined(__SIZEOF_INT128__)
+    compare<uint128>("128-bit");
+#endif
+}
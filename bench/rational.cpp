@@ -0,0 +1,160 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <static_math/rational.h>
+
+// Measures the runtime cost of summing fractions with small
+// denominators with rational, which simplifies the result of
+// every operation, and with lazy_rational, which only simplifies
+// it when the next operation could overflow, then the cost of the
+// overflow-checked operations compared to the unchecked ones
+
+namespace
+{
+    using value_type = long long;
+
+    template<typename Function>
+    auto ns_per_addition(Function func, const std::vector<smath::rational<value_type>>& inputs)
+        -> double
+    {
+        using clock_type = std::chrono::steady_clock;
+        constexpr std::size_t repetitions = 200;
+
+        volatile double sink = 0.0;
+        auto start = clock_type::now();
+        for (std::size_t i = 0 ; i < repetitions ; ++i) {
+            sink = sink + func(inputs);
+        }
+        auto end = clock_type::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (repetitions * inputs.size());
+    }
+
+    auto make_inputs()
+        -> std::vector<smath::rational<value_type>>
+    {
+        std::mt19937_64 engine(0x5eed);
+        std::uniform_int_distribution<value_type> numerators(-99, 99);
+        std::uniform_int_distribution<value_type> denominators(1, 16);
+
+        std::vector<smath::rational<value_type>> res;
+        res.reserve(1 << 12);
+        for (std::size_t i = 0 ; i < (1 << 12) ; ++i) {
+            res.emplace_back(numerators(engine), denominators(engine));
+        }
+        return res;
+    }
+
+    // Fractions whose parts have up to 24 bits, so that the gcd
+    // computations make up most of the cost of an operation
+    auto make_large_inputs()
+        -> std::vector<smath::rational<value_type>>
+    {
+        std::mt19937_64 engine(0x5eed);
+        std::uniform_int_distribution<value_type> numerators(-(1 << 24), 1 << 24);
+        std::uniform_int_distribution<value_type> denominators(1, 1 << 24);
+
+        std::vector<smath::rational<value_type>> res;
+        res.reserve(1 << 12);
+        for (std::size_t i = 0 ; i < (1 << 12) ; ++i) {
+            res.emplace_back(numerators(engine), denominators(engine));
+        }
+        return res;
+    }
+
+    template<typename Function>
+    auto ns_per_operation(Function func, const std::vector<smath::rational<value_type>>& inputs)
+        -> double
+    {
+        using clock_type = std::chrono::steady_clock;
+        constexpr std::size_t repetitions = 200;
+
+        volatile value_type sink = 0;
+        auto start = clock_type::now();
+        for (std::size_t i = 0 ; i < repetitions ; ++i) {
+            value_type acc = 0;
+            for (std::size_t j = 1 ; j < inputs.size() ; ++j) {
+                acc += func(inputs[j - 1], inputs[j]);
+            }
+            sink = sink + acc;
+        }
+        auto end = clock_type::now();
+
+        std::chrono::duration<double, std::nano> elapsed = end - start;
+        return elapsed.count() / (repetitions * (inputs.size() - 1));
+    }
+}
+
+int main()
+{
+    auto inputs = make_inputs();
+
+    // rational is immutable, the running sum is rebuilt from
+    // its already simplified parts at every step
+    double eager_ns = ns_per_addition([](const std::vector<smath::rational<value_type>>& values) {
+        value_type numer = 0;
+        value_type denom = 1;
+        for (const auto& value: values) {
+            auto sum = smath::rational<value_type>(numer, denom) + value;
+            numer = sum.numer;
+            denom = sum.denom;
+        }
+        return static_cast<double>(smath::rational<value_type>(numer, denom));
+    }, inputs);
+
+    double lazy_ns = ns_per_addition([](const std::vector<smath::rational<value_type>>& values) {
+        smath::lazy_rational<value_type> sum = 0;
+        for (const auto& value: values) {
+            sum += value;
+        }
+        return static_cast<double>(sum);
+    }, inputs);
+
+    std::printf("sum  rational: %8.2f ns  lazy_rational: %8.2f ns  speedup: %5.2fx\n",
+                eager_ns, lazy_ns, eager_ns / lazy_ns);
+
+    using ratio = smath::rational<value_type>;
+    auto large_inputs = make_large_inputs();
+
+    double add_ns = ns_per_operation([](ratio lhs, ratio rhs) {
+        return (lhs + rhs).denom;
+    }, large_inputs);
+    double checked_add_ns = ns_per_operation([](ratio lhs, ratio rhs) {
+        return smath::checked_add(lhs, rhs).value.denom;
+    }, large_inputs);
+    double mul_ns = ns_per_operation([](ratio lhs, ratio rhs) {
+        return (lhs * rhs).denom;
+    }, large_inputs);
+    double checked_mul_ns = ns_per_operation([](ratio lhs, ratio rhs) {
+        return smath::checked_mul(lhs, rhs).value.denom;
+    }, large_inputs);
+
+    std::printf("add  unchecked: %8.2f ns  checked: %8.2f ns\n", add_ns, checked_add_ns);
+    std::printf("mul  unchecked: %8.2f ns  checked: %8.2f ns\n", mul_ns, checked_mul_ns);
+}
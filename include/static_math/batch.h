@@ -0,0 +1,276 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_BATCH_H_
+#define SMATH_BATCH_H_
+
+/**
+ * @file static_math/batch.h
+ * @brief Mathematical functions applied to arrays.
+ *
+ * This header provides runtime-only versions of some functions of
+ * static_math/cmath.h which transform a whole array at once. For
+ * double, they evaluate the same polynomial kernels as the scalar
+ * functions with SSE2, AVX2 or AVX-512 instructions, selected
+ * according to the processor the program runs on. The elements
+ * of other types are computed one by one with the scalar kernels.
+ *
+ * By default the vector code is allowed to fuse multiplications
+ * and additions, which can change the last bit of some results.
+ * The overloads taking smath::batch::strict give results which
+ * are bit-identical to the ones of the scalar functions at compile
+ * time.
+ */
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <static_math/cmath.h>
+#include <static_math/constants.h>
+#include "detail/config.h"
+#if defined(__cpp_lib_span)
+#   include <cassert>
+#   include <concepts>
+#   include <ranges>
+#   include <span>
+#endif
+
+namespace smath
+{
+#if defined(__cpp_lib_span)
+namespace detail
+{
+    // The element type of the first input decides the type of
+    // the other inputs and of the output, so that any
+    // contiguous range convertible to the matching std::span
+    // can be passed, including containers
+
+    template<typename Range>
+    concept batch_input = std::ranges::contiguous_range<Range>
+                       && std::ranges::sized_range<Range>
+                       && std::floating_point<std::ranges::range_value_t<Range>>;
+
+    template<typename Range>
+    using batch_value_t = std::ranges::range_value_t<Range>;
+
+    template<typename Range, typename Float>
+    concept batch_other_input = std::convertible_to<Range, std::span<const Float>>;
+
+    template<typename Range, typename Float>
+    concept batch_output = std::convertible_to<Range, std::span<Float>>;
+}
+#endif
+
+namespace batch
+{
+    ////////////////////////////////////////////////////////////
+    // Evaluation modes
+
+    /**
+     * @brief Requests results bit-identical to the scalar functions.
+     */
+    struct strict_t
+    {
+        explicit strict_t() = default;
+    };
+
+    constexpr strict_t strict{};
+
+    ////////////////////////////////////////////////////////////
+    // Functions over arrays
+
+    // out may be equal to the beginning of an input array but must
+    // not otherwise overlap with the inputs
+
+    /**
+     * @brief Sine of every element of [first, last).
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto sin(const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto sin(strict_t, const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    /**
+     * @brief Cosine of every element of [first, last).
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto cos(const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto cos(strict_t, const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    /**
+     * @brief Exponential function of every element of [first, last).
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto exp(const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto exp(strict_t, const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    /**
+     * @brief Natural logarithm of every element of [first, last).
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto log(const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto log(strict_t, const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    /**
+     * @brief Square root of every element of [first, last).
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto sqrt(const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto sqrt(strict_t, const Float* first, const Float* last, Float* out)
+        -> Float*;
+
+    /**
+     * @brief Hypotenuse of every pair of elements of [first_x, last_x)
+     *        and of the array starting at first_y.
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto hypot(const Float* first_x, const Float* last_x, const Float* first_y, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto hypot(strict_t, const Float* first_x, const Float* last_x, const Float* first_y, Float* out)
+        -> Float*;
+
+    /**
+     * @brief Norm of every point whose coordinates are the elements of
+     *        [first_x, last_x) and of the arrays starting at first_y
+     *        and first_z.
+     * @return Iterator past the last element written to out.
+     */
+    template<typename Float>
+    auto hypot(const Float* first_x, const Float* last_x, const Float* first_y,
+               const Float* first_z, Float* out)
+        -> Float*;
+
+    template<typename Float>
+    auto hypot(strict_t, const Float* first_x, const Float* last_x, const Float* first_y,
+               const Float* first_z, Float* out)
+        -> Float*;
+
+#if defined(__cpp_lib_span)
+    ////////////////////////////////////////////////////////////
+    // Functions over contiguous ranges
+
+    // out and the other inputs must be at least as big as the first
+    // input
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto sin(Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto sin(strict_t, Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto cos(Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto cos(strict_t, Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto exp(Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto exp(strict_t, Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto log(Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto log(strict_t, Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto sqrt(Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+    auto sqrt(strict_t, Input&& in, Output&& out)
+        -> void;
+
+    template<detail::batch_input X,
+             detail::batch_other_input<detail::batch_value_t<X>> Y,
+             detail::batch_output<detail::batch_value_t<X>> Output>
+    auto hypot(X&& x, Y&& y, Output&& out)
+        -> void;
+
+    template<detail::batch_input X,
+             detail::batch_other_input<detail::batch_value_t<X>> Y,
+             detail::batch_output<detail::batch_value_t<X>> Output>
+    auto hypot(strict_t, X&& x, Y&& y, Output&& out)
+        -> void;
+
+    template<detail::batch_input X,
+             detail::batch_other_input<detail::batch_value_t<X>> Y,
+             detail::batch_other_input<detail::batch_value_t<X>> Z,
+             detail::batch_output<detail::batch_value_t<X>> Output>
+    auto hypot(X&& x, Y&& y, Z&& z, Output&& out)
+        -> void;
+
+    template<detail::batch_input X,
+             detail::batch_other_input<detail::batch_value_t<X>> Y,
+             detail::batch_other_input<detail::batch_value_t<X>> Z,
+             detail::batch_output<detail::batch_value_t<X>> Output>
+    auto hypot(strict_t, X&& x, Y&& y, Z&& z, Output&& out)
+        -> void;
+#endif
+}
+
+    #include "detail/batch.inl"
+}
+
+#endif // SMATH_BATCH_H_
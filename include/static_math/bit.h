@@ -40,6 +40,7 @@
 #include <cstddef>
 #include <limits>
 #include <static_math/constant.h>
+#include "detail/config.h"
 
 namespace smath
 {
@@ -71,6 +72,14 @@ namespace smath
     constexpr auto log2p1(Unsigned x) noexcept
         -> Unsigned;
 
+    /**
+     * @brief Number of consecutive 0 bits starting from the least
+     *        significant bit of \p x.
+     */
+    template<typename Unsigned>
+    constexpr auto countr_zero(Unsigned x) noexcept
+        -> int;
+
     #include "detail/bit.inl"
 }
 
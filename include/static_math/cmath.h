@@ -34,6 +34,10 @@
  * do not exist here) and some additional features can be
  * added to some of the functions, such as a variadic number
  * of arguments or a support for more different types.
+ *
+ * When runtime dispatch is enabled (see detail/config.h), the
+ * functions forward to their standard library counterparts when
+ * they are not evaluated at compile time.
  */
 
 ////////////////////////////////////////////////////////////
@@ -48,7 +52,12 @@
 #include <utility>
 #include <static_math/constant.h>
 #include <static_math/constants.h>
+#include "detail/config.h"
 #include "detail/core.h"
+#include "detail/floating_point.h"
+#include "detail/minimax.h"
+#include "detail/polynomial.h"
+#include "detail/reduction.h"
 
 namespace smath
 {
@@ -114,6 +123,53 @@ namespace smath
     constexpr auto trunc(Float x)
         -> decltype(std::trunc(x));
 
+    template<typename Number1, typename Number2>
+    constexpr auto fmod(Number1 x, Number2 y)
+        -> decltype(std::fmod(x, y));
+
+    template<typename Number1, typename Number2>
+    constexpr auto remainder(Number1 x, Number2 y)
+        -> decltype(std::remainder(x, y));
+
+    template<typename Number1, typename Number2>
+    constexpr auto remquo(Number1 x, Number2 y, int* quo)
+        -> decltype(std::remquo(x, y, quo));
+
+    ////////////////////////////////////////////////////////////
+    // Floating point manipulation functions
+
+    template<typename Float>
+    constexpr auto frexp(Float x, int* exp)
+        -> decltype(std::frexp(x, exp));
+
+    template<typename Float>
+    constexpr auto ldexp(Float x, int exp)
+        -> decltype(std::ldexp(x, exp));
+
+    template<typename Float>
+    constexpr auto scalbn(Float x, int exp)
+        -> decltype(std::scalbn(x, exp));
+
+    template<typename Float>
+    constexpr auto ilogb(Float x)
+        -> int;
+
+    template<typename Float>
+    constexpr auto logb(Float x)
+        -> decltype(std::logb(x));
+
+    template<typename Number1, typename Number2>
+    constexpr auto nextafter(Number1 from, Number2 to)
+        -> decltype(std::nextafter(from, to));
+
+    template<typename Number1, typename Number2>
+    constexpr auto copysign(Number1 x, Number2 y)
+        -> decltype(std::copysign(x, y));
+
+    template<typename Float>
+    constexpr auto signbit(Float x)
+        -> bool;
+
     ////////////////////////////////////////////////////////////
     // Power and logarithmic functions
 
@@ -125,14 +181,52 @@ namespace smath
         -> decltype(std::exp(x));
 
     /**
-     * @brief Power function
-     *
-     * @warning This functions is only available for the integer
-     * @warning exponent right now.
+     * @brief Base 2 exponential function
+     */
+    template<typename Float>
+    constexpr auto exp2(Float x)
+        -> decltype(std::exp2(x));
+
+    /**
+     * @brief Base 10 exponential function
+     */
+    template<typename Float>
+    constexpr auto exp10(Float x)
+        -> decltype(std::exp(x));
+
+    /**
+     * @brief exp(x) - 1, accurate for x near 0
+     */
+    template<typename Float>
+    constexpr auto expm1(Float x)
+        -> decltype(std::expm1(x));
+
+    /**
+     * @brief Power function with an integer exponent
      */
     template<typename Number, typename Integer>
     constexpr auto pow(Number x, Integer exponent)
-        -> std::common_type_t<Number, Integer>;
+        -> std::enable_if_t<
+            std::is_integral<Integer>::value,
+            std::common_type_t<Number, Integer>
+        >;
+
+    /**
+     * @brief Power function with a floating point exponent
+     */
+    template<typename Number, typename Float>
+    constexpr auto pow(Number x, Float exponent)
+        -> std::enable_if_t<
+            std::is_floating_point<Float>::value,
+            decltype(std::pow(x, exponent))
+        >;
+
+    /**
+     * @brief Cube root function
+     */
+    template<typename Float>
+    constexpr auto cbrt(Float x)
+        -> decltype(std::cbrt(x));
 
     /**
      * @brief Natural Log function
@@ -141,6 +235,13 @@ namespace smath
     constexpr auto log(Float x)
         -> decltype(std::log(x));
 
+    /**
+     * @brief log(1 + x), accurate for x near 0
+     */
+    template<typename Float>
+    constexpr auto log1p(Float x)
+        -> decltype(std::log1p(x));
+
     /**
      * @brief Log base 2 function
      */
@@ -204,6 +305,57 @@ namespace smath
     constexpr auto tan(Float x)
         -> Float;
 
+    // Return type of sincos
+    template<typename Float>
+    struct sincos_t
+    {
+        Float sin;
+        Float cos;
+    };
+
+    /**
+     * @brief Computes both sine and cosine at once.
+     * @param x Angle in radians
+     *
+     * The argument reduction is only performed once.
+     */
+    template<typename Float>
+    constexpr auto sincos(Float x)
+        -> sincos_t<decltype(std::sin(x))>;
+
+    /**
+     * @brief Arc sine function.
+     * @return Angle in radians in [-pi/2, pi/2]
+     */
+    template<typename Float>
+    constexpr auto asin(Float x)
+        -> decltype(std::asin(x));
+
+    /**
+     * @brief Arc cosine function.
+     * @return Angle in radians in [0, pi]
+     */
+    template<typename Float>
+    constexpr auto acos(Float x)
+        -> decltype(std::acos(x));
+
+    /**
+     * @brief Arc tangent function.
+     * @return Angle in radians in [-pi/2, pi/2]
+     */
+    template<typename Float>
+    constexpr auto atan(Float x)
+        -> decltype(std::atan(x));
+
+    /**
+     * @brief Arc tangent of y/x using the signs of both
+     *        arguments to determine the quadrant.
+     * @return Angle in radians in [-pi, pi]
+     */
+    template<typename Number1, typename Number2>
+    constexpr auto atan2(Number1 y, Number2 x)
+        -> decltype(std::atan2(y, x));
+
     ////////////////////////////////////////////////////////////
     // Hyperbolic functions
 
@@ -231,6 +383,53 @@ namespace smath
     constexpr auto tanh(Float x)
         -> Float;
 
+    // Return type of sinhcosh
+    template<typename Float>
+    struct sinhcosh_t
+    {
+        Float sinh;
+        Float cosh;
+    };
+
+    /**
+     * @brief Computes both hyperbolic sine and cosine at once.
+     * @param x Hyperbolic angle in radians
+     */
+    template<typename Float>
+    constexpr auto sinhcosh(Float x)
+        -> sinhcosh_t<decltype(std::sinh(x))>;
+
+    ////////////////////////////////////////////////////////////
+    // Error and gamma functions
+
+    /**
+     * @brief Error function.
+     */
+    template<typename Float>
+    constexpr auto erf(Float x)
+        -> decltype(std::erf(x));
+
+    /**
+     * @brief Complementary error function.
+     */
+    template<typename Float>
+    constexpr auto erfc(Float x)
+        -> decltype(std::erfc(x));
+
+    /**
+     * @brief Gamma function.
+     */
+    template<typename Float>
+    constexpr auto tgamma(Float x)
+        -> decltype(std::tgamma(x));
+
+    /**
+     * @brief Natural logarithm of the absolute value of the gamma function.
+     */
+    template<typename Float>
+    constexpr auto lgamma(Float x)
+        -> decltype(std::lgamma(x));
+
     #include "detail/cmath.inl"
 }
 
@@ -329,6 +329,10 @@ namespace smath
     constexpr auto abs(complex<T> z)
         -> T;
 
+    template<typename T>
+    constexpr auto arg(complex<T> z)
+        -> T;
+
     template<typename T>
     constexpr auto norm(complex<T> z)
         -> T;
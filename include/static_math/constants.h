@@ -55,6 +55,14 @@ namespace constants
     template<typename T=double>
     constexpr T pi = static_cast<T>(3.14159265358979323846L);
 
+    /** sqrt(2) */
+    template<typename T=double>
+    constexpr T sqrt2 = static_cast<T>(1.41421356237309504880L);
+
+    /** 1/sqrt(2) */
+    template<typename T=double>
+    constexpr T sqrt1_2 = static_cast<T>(0.70710678118654752440L);
+
     ////////////////////////////////////////////////////////////
     // Other mathematical constants
 
@@ -0,0 +1,648 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+////////////////////////////////////////////////////////////
+// Helper functions
+
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Functions applied by the batch functions
+
+    struct sin_tag
+    {
+        template<typename Float>
+        static auto scalar(Float x)
+            -> Float
+        {
+            return detail::sin_helper(x);
+        }
+    };
+
+    struct cos_tag
+    {
+        template<typename Float>
+        static auto scalar(Float x)
+            -> Float
+        {
+            return detail::cos_helper(x);
+        }
+    };
+
+    struct exp_tag
+    {
+        template<typename Float>
+        static auto scalar(Float x)
+            -> Float
+        {
+            return detail::exp_helper(x);
+        }
+    };
+
+    struct log_tag
+    {
+        template<typename Float>
+        static auto scalar(Float x)
+            -> Float
+        {
+            return detail::logf_helper(x);
+        }
+    };
+
+    struct sqrt_tag
+    {
+        template<typename Float>
+        static auto scalar(Float x)
+            -> Float
+        {
+            return detail::sqrt_helper(x);
+        }
+    };
+
+    struct hypot_tag
+    {
+        template<typename Float>
+        static auto scalar(Float x, Float y)
+            -> Float
+        {
+            return detail::hypot_helper(x, y);
+        }
+
+        template<typename Float>
+        static auto scalar(Float x, Float y, Float z)
+            -> Float
+        {
+            return detail::hypot_helper(x, y, z);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Contraction-free scalar functions
+    //
+    // The scalar functions are compiled with the user's options,
+    // which may allow the compiler to fuse multiplications and
+    // additions. The strict batch functions apply them through a
+    // flattened function: the whole scalar computation is inlined
+    // into it and compiled without floating point contraction, so
+    // that it gives the same results as at compile time
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+    namespace scalar_strict
+    {
+        template<typename Tag, typename... Args>
+#if defined(__GNUC__)
+        __attribute__((flatten))
+#endif
+        auto apply(Tag, Args... args)
+            -> decltype(Tag::scalar(args...))
+        {
+            return Tag::scalar(args...);
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#endif
+
+    ////////////////////////////////////////////////////////////
+    // Scalar loop
+
+    template<typename Tag, typename Float>
+    auto batch_transform(Tag tag, bool strict, const Float* first, const Float* last, Float* out)
+        -> Float*
+    {
+        for (; first != last ; ++first, ++out) {
+            *out = strict ? scalar_strict::apply(tag, *first)
+                          : Tag::scalar(*first);
+        }
+        return out;
+    }
+
+    template<typename Tag, typename Float>
+    auto batch_transform(Tag tag, bool strict, const Float* first, const Float* last,
+                         const Float* first2, Float* out)
+        -> Float*
+    {
+        for (; first != last ; ++first, ++first2, ++out) {
+            *out = strict ? scalar_strict::apply(tag, *first, *first2)
+                          : Tag::scalar(*first, *first2);
+        }
+        return out;
+    }
+
+    template<typename Tag, typename Float>
+    auto batch_transform(Tag tag, bool strict, const Float* first, const Float* last,
+                         const Float* first2, const Float* first3, Float* out)
+        -> Float*
+    {
+        for (; first != last ; ++first, ++first2, ++first3, ++out) {
+            *out = strict ? scalar_strict::apply(tag, *first, *first2, *first3)
+                          : Tag::scalar(*first, *first2, *first3);
+        }
+        return out;
+    }
+
+#ifdef STATIC_MATH_HAS_BATCH_SIMD
+    ////////////////////////////////////////////////////////////
+    // Vector kernels, once per instruction set; the strict ones
+    // are compiled without floating point contraction
+
+#pragma GCC push_options
+#pragma GCC target("sse2")
+namespace simd_sse2
+{
+#   define STATIC_MATH_BATCH_WIDTH 2
+#   include "batch_kernels.inl"
+#   undef STATIC_MATH_BATCH_WIDTH
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#pragma GCC optimize("fp-contract=off")
+namespace simd_sse2_strict
+{
+#   define STATIC_MATH_BATCH_WIDTH 2
+#   define STATIC_MATH_BATCH_STRICT
+#   include "batch_kernels.inl"
+#   undef STATIC_MATH_BATCH_STRICT
+#   undef STATIC_MATH_BATCH_WIDTH
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+namespace simd_avx2
+{
+#   define STATIC_MATH_BATCH_WIDTH 4
+#   include "batch_kernels.inl"
+#   undef STATIC_MATH_BATCH_WIDTH
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#pragma GCC optimize("fp-contract=off")
+namespace simd_avx2_strict
+{
+#   define STATIC_MATH_BATCH_WIDTH 4
+#   define STATIC_MATH_BATCH_STRICT
+#   include "batch_kernels.inl"
+#   undef STATIC_MATH_BATCH_STRICT
+#   undef STATIC_MATH_BATCH_WIDTH
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+namespace simd_avx512
+{
+#   define STATIC_MATH_BATCH_WIDTH 8
+#   include "batch_kernels.inl"
+#   undef STATIC_MATH_BATCH_WIDTH
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC optimize("fp-contract=off")
+namespace simd_avx512_strict
+{
+#   define STATIC_MATH_BATCH_WIDTH 8
+#   define STATIC_MATH_BATCH_STRICT
+#   include "batch_kernels.inl"
+#   undef STATIC_MATH_BATCH_STRICT
+#   undef STATIC_MATH_BATCH_WIDTH
+}
+#pragma GCC pop_options
+
+    ////////////////////////////////////////////////////////////
+    // Runtime instruction set selection
+
+    enum class simd_isa
+    {
+        none,
+        sse2,
+        avx2,
+        avx512
+    };
+
+    inline auto detect_simd_isa()
+        -> simd_isa
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return simd_isa::avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return simd_isa::avx2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return simd_isa::sse2;
+        }
+        return simd_isa::none;
+    }
+
+    inline auto current_simd_isa()
+        -> simd_isa
+    {
+        static const simd_isa isa = detect_simd_isa();
+        return isa;
+    }
+
+    template<typename Tag>
+    auto batch_transform(Tag tag, bool strict, const double* first, const double* last, double* out)
+        -> double*
+    {
+        switch (current_simd_isa()) {
+            case simd_isa::avx512:
+                strict ? simd_avx512_strict::transform(tag, first, last, out)
+                       : simd_avx512::transform(tag, first, last, out);
+                break;
+            case simd_isa::avx2:
+                strict ? simd_avx2_strict::transform(tag, first, last, out)
+                       : simd_avx2::transform(tag, first, last, out);
+                break;
+            case simd_isa::sse2:
+                strict ? simd_sse2_strict::transform(tag, first, last, out)
+                       : simd_sse2::transform(tag, first, last, out);
+                break;
+            default:
+                for (; first != last ; ++first, ++out) {
+                    *out = strict ? scalar_strict::apply(tag, *first)
+                                  : Tag::scalar(*first);
+                }
+                return out;
+        }
+        return out + (last - first);
+    }
+
+    template<typename Tag>
+    auto batch_transform(Tag tag, bool strict, const double* first, const double* last,
+                         const double* first2, double* out)
+        -> double*
+    {
+        switch (current_simd_isa()) {
+            case simd_isa::avx512:
+                strict ? simd_avx512_strict::transform(tag, first, last, first2, out)
+                       : simd_avx512::transform(tag, first, last, first2, out);
+                break;
+            case simd_isa::avx2:
+                strict ? simd_avx2_strict::transform(tag, first, last, first2, out)
+                       : simd_avx2::transform(tag, first, last, first2, out);
+                break;
+            case simd_isa::sse2:
+                strict ? simd_sse2_strict::transform(tag, first, last, first2, out)
+                       : simd_sse2::transform(tag, first, last, first2, out);
+                break;
+            default:
+                for (; first != last ; ++first, ++first2, ++out) {
+                    *out = strict ? scalar_strict::apply(tag, *first, *first2)
+                                  : Tag::scalar(*first, *first2);
+                }
+                return out;
+        }
+        return out + (last - first);
+    }
+
+    template<typename Tag>
+    auto batch_transform(Tag tag, bool strict, const double* first, const double* last,
+                         const double* first2, const double* first3, double* out)
+        -> double*
+    {
+        switch (current_simd_isa()) {
+            case simd_isa::avx512:
+                strict ? simd_avx512_strict::transform(tag, first, last, first2, first3, out)
+                       : simd_avx512::transform(tag, first, last, first2, first3, out);
+                break;
+            case simd_isa::avx2:
+                strict ? simd_avx2_strict::transform(tag, first, last, first2, first3, out)
+                       : simd_avx2::transform(tag, first, last, first2, first3, out);
+                break;
+            case simd_isa::sse2:
+                strict ? simd_sse2_strict::transform(tag, first, last, first2, first3, out)
+                       : simd_sse2::transform(tag, first, last, first2, first3, out);
+                break;
+            default:
+                for (; first != last ; ++first, ++first2, ++first3, ++out) {
+                    *out = strict ? scalar_strict::apply(tag, *first, *first2, *first3)
+                                  : Tag::scalar(*first, *first2, *first3);
+                }
+                return out;
+        }
+        return out + (last - first);
+    }
+#endif
+}
+
+namespace batch
+{
+////////////////////////////////////////////////////////////
+// Functions over arrays
+
+template<typename Float>
+auto sin(const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::sin_tag{}, false, first, last, out);
+}
+
+template<typename Float>
+auto sin(strict_t, const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::sin_tag{}, true, first, last, out);
+}
+
+template<typename Float>
+auto cos(const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::cos_tag{}, false, first, last, out);
+}
+
+template<typename Float>
+auto cos(strict_t, const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::cos_tag{}, true, first, last, out);
+}
+
+template<typename Float>
+auto exp(const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::exp_tag{}, false, first, last, out);
+}
+
+template<typename Float>
+auto exp(strict_t, const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::exp_tag{}, true, first, last, out);
+}
+
+template<typename Float>
+auto log(const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::log_tag{}, false, first, last, out);
+}
+
+template<typename Float>
+auto log(strict_t, const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::log_tag{}, true, first, last, out);
+}
+
+template<typename Float>
+auto sqrt(const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::sqrt_tag{}, false, first, last, out);
+}
+
+template<typename Float>
+auto sqrt(strict_t, const Float* first, const Float* last, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::sqrt_tag{}, true, first, last, out);
+}
+
+template<typename Float>
+auto hypot(const Float* first_x, const Float* last_x, const Float* first_y, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::hypot_tag{}, false, first_x, last_x, first_y, out);
+}
+
+template<typename Float>
+auto hypot(strict_t, const Float* first_x, const Float* last_x, const Float* first_y, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::hypot_tag{}, true, first_x, last_x, first_y, out);
+}
+
+template<typename Float>
+auto hypot(const Float* first_x, const Float* last_x, const Float* first_y,
+           const Float* first_z, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::hypot_tag{}, false, first_x, last_x,
+                                   first_y, first_z, out);
+}
+
+template<typename Float>
+auto hypot(strict_t, const Float* first_x, const Float* last_x, const Float* first_y,
+           const Float* first_z, Float* out)
+    -> Float*
+{
+    return detail::batch_transform(detail::hypot_tag{}, true, first_x, last_x,
+                                   first_y, first_z, out);
+}
+
+#if defined(__cpp_lib_span)
+////////////////////////////////////////////////////////////
+// Functions over contiguous ranges
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto sin(Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::sin(x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto sin(strict_t, Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::sin(strict, x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto cos(Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::cos(x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto cos(strict_t, Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::cos(strict, x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto exp(Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::exp(x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto exp(strict_t, Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::exp(strict, x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto log(Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::log(x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto log(strict_t, Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::log(strict, x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto sqrt(Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::sqrt(x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input Input, detail::batch_output<detail::batch_value_t<Input>> Output>
+auto sqrt(strict_t, Input&& in, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<Input>;
+    const std::span<const float_type> x = in;
+    const std::span<float_type> res = out;
+    assert(res.size() >= x.size());
+    batch::sqrt(strict, x.data(), x.data() + x.size(), res.data());
+}
+
+template<detail::batch_input X,
+         detail::batch_other_input<detail::batch_value_t<X>> Y,
+         detail::batch_output<detail::batch_value_t<X>> Output>
+auto hypot(X&& x, Y&& y, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<X>;
+    const std::span<const float_type> xs = x;
+    const std::span<const float_type> ys = y;
+    const std::span<float_type> res = out;
+    assert(ys.size() >= xs.size());
+    assert(res.size() >= xs.size());
+    batch::hypot(xs.data(), xs.data() + xs.size(), ys.data(), res.data());
+}
+
+template<detail::batch_input X,
+         detail::batch_other_input<detail::batch_value_t<X>> Y,
+         detail::batch_output<detail::batch_value_t<X>> Output>
+auto hypot(strict_t, X&& x, Y&& y, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<X>;
+    const std::span<const float_type> xs = x;
+    const std::span<const float_type> ys = y;
+    const std::span<float_type> res = out;
+    assert(ys.size() >= xs.size());
+    assert(res.size() >= xs.size());
+    batch::hypot(strict, xs.data(), xs.data() + xs.size(), ys.data(), res.data());
+}
+
+template<detail::batch_input X,
+         detail::batch_other_input<detail::batch_value_t<X>> Y,
+         detail::batch_other_input<detail::batch_value_t<X>> Z,
+         detail::batch_output<detail::batch_value_t<X>> Output>
+auto hypot(X&& x, Y&& y, Z&& z, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<X>;
+    const std::span<const float_type> xs = x;
+    const std::span<const float_type> ys = y;
+    const std::span<const float_type> zs = z;
+    const std::span<float_type> res = out;
+    assert(ys.size() >= xs.size());
+    assert(zs.size() >= xs.size());
+    assert(res.size() >= xs.size());
+    batch::hypot(xs.data(), xs.data() + xs.size(), ys.data(), zs.data(), res.data());
+}
+
+template<detail::batch_input X,
+         detail::batch_other_input<detail::batch_value_t<X>> Y,
+         detail::batch_other_input<detail::batch_value_t<X>> Z,
+         detail::batch_output<detail::batch_value_t<X>> Output>
+auto hypot(strict_t, X&& x, Y&& y, Z&& z, Output&& out)
+    -> void
+{
+    using float_type = detail::batch_value_t<X>;
+    const std::span<const float_type> xs = x;
+    const std::span<const float_type> ys = y;
+    const std::span<const float_type> zs = z;
+    const std::span<float_type> res = out;
+    assert(ys.size() >= xs.size());
+    assert(zs.size() >= xs.size());
+    assert(res.size() >= xs.size());
+    batch::hypot(strict, xs.data(), xs.data() + xs.size(), ys.data(), zs.data(), res.data());
+}
+#endif
+}
@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// This file has no include guard: batch.inl includes it once per
+// instruction set, every time in a namespace of its own and with
+// the matching target options, after having defined the macro
+// STATIC_MATH_BATCH_WIDTH to the number of doubles in a vector,
+// and STATIC_MATH_BATCH_STRICT for the strict namespaces.
+//
+// The vector kernels perform exactly the same operations as the
+// scalar double kernels from cmath.inl, in the same order, so that
+// both give the same results when floating point contraction is
+// disabled. Lanes that the scalar functions handle with a special
+// case (NaN, infinities, huge arguments, subnormal numbers...) are
+// flagged and computed with the scalar functions instead.
+
+typedef double vdouble __attribute__((vector_size(8 * STATIC_MATH_BATCH_WIDTH)));
+typedef std::int64_t vint64 __attribute__((vector_size(8 * STATIC_MATH_BATCH_WIDTH)));
+typedef std::int32_t vint32 __attribute__((vector_size(4 * STATIC_MATH_BATCH_WIDTH)));
+
+////////////////////////////////////////////////////////////
+// Basic operations
+
+inline auto broadcast(double x)
+    -> vdouble
+{
+    return vdouble{} + x;
+}
+
+inline auto abs(vdouble x)
+    -> vdouble
+{
+    return (vdouble) ((vint64) x & 0x7fffffffffffffff);
+}
+
+// static_cast<int>(x < 0 ? x - 0.5 : x + 0.5), valid when the
+// result fits in 32 bits
+inline auto round_to_int(vdouble x)
+    -> vint32
+{
+    return __builtin_convertvector(x < 0 ? x - 0.5 : x + 0.5, vint32);
+}
+
+inline auto to_double(vint32 x)
+    -> vdouble
+{
+    return __builtin_convertvector(x, vdouble);
+}
+
+// 2^n for lanes where it is a normal number
+inline auto pow2(vint64 n)
+    -> vdouble
+{
+    return (vdouble) ((n + 1023) << 52);
+}
+
+// Splits normal positive numbers into a mantissa in [0.5, 1) and
+// a power of 2, like frexp_helper
+inline auto frexp(vdouble x, vint64& exp)
+    -> vdouble
+{
+    const vint64 bits = (vint64) x;
+    exp = ((bits >> 52) & 0x7ff) - 1022;
+    return (vdouble) ((bits & 0x000fffffffffffff) | 0x3fe0000000000000);
+}
+
+// Lanes holding normal positive numbers
+inline auto is_normal_positive(vdouble x)
+    -> vint64
+{
+    return (x >= std::numeric_limits<double>::min()) & (x <= std::numeric_limits<double>::max());
+}
+
+////////////////////////////////////////////////////////////
+// Polynomial evaluation, see polynomial.h
+
+template<std::size_t N>
+inline auto horner(vdouble x, const polynomial<double, N>& poly)
+    -> vdouble
+{
+    vdouble res = broadcast(poly.coefficients[N - 1]);
+    for (std::size_t i = N - 1 ; i > 0 ; --i) {
+        res = res * x + poly.coefficients[i - 1];
+    }
+    return res;
+}
+
+template<std::size_t N>
+inline auto estrin(vdouble x, const polynomial<double, N>& poly)
+    -> vdouble
+{
+    vdouble terms[N] = {};
+    for (std::size_t i = 0 ; i < N ; ++i) {
+        terms[i] = broadcast(poly.coefficients[i]);
+    }
+
+    std::size_t size = N;
+    vdouble power = x;
+    while (size > 1) {
+        for (std::size_t i = 0 ; i < size / 2 ; ++i) {
+            terms[i] = terms[2 * i] + terms[2 * i + 1] * power;
+        }
+        if (size % 2 != 0) {
+            terms[size / 2] = terms[size - 1];
+        }
+        size = (size + 1) / 2;
+        power *= power;
+    }
+    return terms[0];
+}
+
+template<std::size_t N>
+inline auto evaluate(vdouble x, const polynomial<double, N>& poly)
+    -> vdouble
+{
+    return (N > 4) ? estrin(x, poly) : horner(x, poly);
+}
+
+////////////////////////////////////////////////////////////
+// sin & cos
+
+inline auto sin_kernel(vdouble x)
+    -> vdouble
+{
+    const vdouble z = x * x;
+    return x + x * z * evaluate(z, sin_minimax<53>::coefficients());
+}
+
+inline auto cos_kernel(vdouble x)
+    -> vdouble
+{
+    const vdouble z = x * x;
+    const vdouble hz = z / 2;
+    const vdouble w = 1 - hz;
+    return w + (((1 - w) - hz) + z * z * evaluate(z, cos_minimax<53>::coefficients()));
+}
+
+// Cody-Waite part of rem_pio2, lanes which would need the
+// Payne-Hanek reduction are flagged in ok
+inline auto rem_pio2(vdouble x, vint64& quadrant, vint64& ok)
+    -> vdouble
+{
+    using split = pio2_split<53>;
+
+    const vdouble abs_x = abs(x);
+    const vint64 small = abs_x <= split::hi / 2;
+    const vint64 medium = abs_x < double(1 << 19);
+
+    // Keep the conversions to int valid for the other lanes
+    const vdouble mx = medium ? x : broadcast(0.0);
+    const vint32 k = round_to_int(mx / split::hi);
+    const vdouble fk = to_double(k);
+    const vdouble res = ((mx - fk * split::c1) - fk * split::c2) - fk * split::c3;
+
+    ok = small | (medium & (abs(res) >= detail::pow2<double>(68 - 2 * 53)));
+    quadrant = small ? vint64{} : (__builtin_convertvector(k, vint64) & 3);
+    return small ? x : res;
+}
+
+inline auto kernel(sin_tag, vdouble x, vint64& ok)
+    -> vdouble
+{
+    vint64 quadrant;
+    const vdouble r = rem_pio2(x, quadrant, ok);
+    const vdouble s = sin_kernel(r);
+    const vdouble c = cos_kernel(r);
+    const vdouble res = (quadrant & 1) ? c : s;
+    // Preserve the sign of zero like sin_helper
+    return (x == 0) ? x : (quadrant & 2) ? -res : res;
+}
+
+inline auto kernel(cos_tag, vdouble x, vint64& ok)
+    -> vdouble
+{
+    vint64 quadrant;
+    const vdouble r = rem_pio2(x, quadrant, ok);
+    const vdouble s = sin_kernel(r);
+    const vdouble c = cos_kernel(r);
+    const vdouble res = (quadrant & 1) ? s : c;
+    return ((quadrant + 1) & 2) ? -res : res;
+}
+
+////////////////////////////////////////////////////////////
+// exp
+
+inline auto kernel(exp_tag, vdouble x, vint64& ok)
+    -> vdouble
+{
+    using split = ln2_split<53>;
+
+    // Results and their scaling by 2^k are normal in this range
+    ok = (x >= -708.0) & (x <= 708.0);
+    const vdouble wx = ok ? x : broadcast(0.0);
+
+    const vdouble t = wx * constants::log2e<double>;
+    const vint32 k = round_to_int(t);
+    const vdouble dk = to_double(k);
+    const vdouble hi = wx - dk * split::hi;
+    const vdouble lo = dk * split::lo;
+    const vdouble r = hi - lo;
+
+    const vdouble z = r * r;
+    const vdouble c = r - z * evaluate(z, exp_minimax<53>::coefficients());
+    const vdouble y = 1 - ((lo - (r * c) / (2 - c)) - hi);
+
+    return y * pow2(__builtin_convertvector(k, vint64));
+}
+
+////////////////////////////////////////////////////////////
+// log
+
+inline auto kernel(log_tag, vdouble x, vint64& ok)
+    -> vdouble
+{
+    using split = ln2_split<53>;
+
+    ok = is_normal_positive(x);
+    vint64 k;
+    vdouble m = frexp(ok ? x : broadcast(1.0), k);
+    const vint64 low = m < constants::sqrt1_2<double>;
+    m = low ? m * 2 : m;
+    k = low ? k - 1 : k;
+
+    const vdouble f = m - 1;
+    const vdouble dk = to_double(__builtin_convertvector(k, vint32));
+    const vdouble hfsq = f * f / 2;
+    const vdouble s = f / (2 + f);
+    const vdouble z = s * s;
+    const vdouble r = z * evaluate(z, log_minimax<53>::coefficients());
+    return dk * split::hi + (f - (hfsq - (s * (hfsq + r) + dk * split::lo)));
+}
+
+////////////////////////////////////////////////////////////
+// sqrt
+
+inline auto kernel(sqrt_tag, vdouble x, vint64& ok)
+    -> vdouble
+{
+    ok = is_normal_positive(x);
+    vint64 e;
+    vdouble m = frexp(ok ? x : broadcast(1.0), e);
+    const vint64 odd = (e & 1) != 0;
+    m = odd ? m / 2 : m;
+    e = odd ? e + 1 : e;
+
+    vdouble y = horner(m, sqrt_seed());
+    for (int i = 0 ; i < 2 ; ++i) {
+        y = (y + m / y) / 2;
+    }
+
+    // two_prod(y, y)
+    constexpr double factor = detail::pow2<double>(27) + 1;
+    const vdouble p = y * y;
+    const vdouble c = factor * y;
+    const vdouble yhi = c - (c - y);
+    const vdouble ylo = y - yhi;
+    const vdouble err = ((yhi * yhi - p) + yhi * ylo + ylo * yhi) + ylo * ylo;
+    y += ((m - p) - err) / (2 * y);
+
+    return y * pow2(e >> 1);
+}
+
+////////////////////////////////////////////////////////////
+// hypot
+
+// two_prod(x, x), the rounding error being stored in err
+inline auto square(vdouble x, vdouble& err)
+    -> vdouble
+{
+    constexpr double factor = detail::pow2<double>(27) + 1;
+    const vdouble p = x * x;
+    const vdouble c = factor * x;
+    const vdouble xhi = c - (c - x);
+    const vdouble xlo = x - xhi;
+    err = ((xhi * xhi - p) + xhi * xlo + xlo * xhi) + xlo * xlo;
+    return p;
+}
+
+// hypot_add_square from cmath.inl
+inline auto add_square(vdouble& hi, vdouble& lo, vdouble x)
+    -> void
+{
+    vdouble err;
+    const vdouble p = square(x, err);
+
+    // two_sum(hi, p)
+    const vdouble s = hi + p;
+    const vdouble bv = s - hi;
+    const vdouble s_err = (hi - (s - bv)) + (p - bv);
+    lo = s_err + (lo + err);
+    hi = s;
+}
+
+// Lanes where the greatest argument m is in the range where the
+// scalar kernels need no scaling, and none of the arguments is NaN
+inline auto hypot_unscaled(vdouble m)
+    -> vint64
+{
+    return (m >= hypot_unscaled_min<double>()) & (m <= hypot_unscaled_max<double>());
+}
+
+// hypot_finish from cmath.inl, seeded with the sqrt kernel
+inline auto hypot_finish(vdouble hi, vdouble lo)
+    -> vdouble
+{
+    vint64 ok;
+    const vdouble r = kernel(sqrt_tag{}, hi, ok);
+    vdouble err;
+    const vdouble p = square(r, err);
+    return r + (((hi - p) - err) + lo) / (2 * r);
+}
+
+inline auto kernel(hypot_tag, vdouble x, vdouble y, vint64& ok)
+    -> vdouble
+{
+    const vdouble ax = abs(x);
+    const vdouble ay = abs(y);
+    const vdouble m = (ax < ay) ? ay : ax;
+    ok = (ax <= m) & (ay <= m) & hypot_unscaled(m);
+
+    vdouble lo;
+    vdouble hi = square(ax, lo);
+    add_square(hi, lo, ay);
+    return hypot_finish(hi, lo);
+}
+
+inline auto kernel(hypot_tag, vdouble x, vdouble y, vdouble z, vint64& ok)
+    -> vdouble
+{
+    const vdouble ax = abs(x);
+    const vdouble ay = abs(y);
+    const vdouble az = abs(z);
+    const vdouble mxy = (ax < ay) ? ay : ax;
+    const vdouble m = (mxy < az) ? az : mxy;
+    ok = (ax <= m) & (ay <= m) & (az <= m) & hypot_unscaled(m);
+
+    vdouble lo;
+    vdouble hi = square(ax, lo);
+    add_square(hi, lo, ay);
+    add_square(hi, lo, az);
+    return hypot_finish(hi, lo);
+}
+
+////////////////////////////////////////////////////////////
+// Scalar fallback for the flagged lanes and the last elements
+
+// In the strict namespaces, the scalar function is flattened so
+// that the whole computation is compiled with the options of the
+// namespace, without floating point contraction; see scalar_strict
+// in batch.inl
+
+template<typename Tag, typename... Args>
+#ifdef STATIC_MATH_BATCH_STRICT
+__attribute__((flatten))
+#endif
+inline auto scalar(Tag, Args... args)
+    -> double
+{
+    return Tag::scalar(args...);
+}
+
+////////////////////////////////////////////////////////////
+// Loop over the elements
+
+template<typename Tag>
+inline auto transform(Tag tag, const double* first, const double* last, double* out)
+    -> void
+{
+    constexpr int width = STATIC_MATH_BATCH_WIDTH;
+    for (; last - first >= width ; first += width, out += width) {
+        vdouble x;
+        std::memcpy(&x, first, sizeof x);
+        vint64 ok;
+        const vdouble res = kernel(tag, x, ok);
+        std::memcpy(out, &res, sizeof res);
+        for (int i = 0 ; i < width ; ++i) {
+            if (!ok[i]) {
+                out[i] = scalar(tag, x[i]);
+            }
+        }
+    }
+
+    // Remaining elements
+    for (; first != last ; ++first, ++out) {
+        *out = scalar(tag, *first);
+    }
+}
+
+template<typename Tag>
+inline auto transform(Tag tag, const double* first, const double* last,
+                      const double* first2, double* out)
+    -> void
+{
+    constexpr int width = STATIC_MATH_BATCH_WIDTH;
+    for (; last - first >= width ; first += width, first2 += width, out += width) {
+        vdouble x, y;
+        std::memcpy(&x, first, sizeof x);
+        std::memcpy(&y, first2, sizeof y);
+        vint64 ok;
+        const vdouble res = kernel(tag, x, y, ok);
+        std::memcpy(out, &res, sizeof res);
+        for (int i = 0 ; i < width ; ++i) {
+            if (!ok[i]) {
+                out[i] = scalar(tag, x[i], y[i]);
+            }
+        }
+    }
+
+    // Remaining elements
+    for (; first != last ; ++first, ++first2, ++out) {
+        *out = scalar(tag, *first, *first2);
+    }
+}
+
+template<typename Tag>
+inline auto transform(Tag tag, const double* first, const double* last,
+                      const double* first2, const double* first3, double* out)
+    -> void
+{
+    constexpr int width = STATIC_MATH_BATCH_WIDTH;
+    for (; last - first >= width ; first += width, first2 += width, first3 += width, out += width) {
+        vdouble x, y, z;
+        std::memcpy(&x, first, sizeof x);
+        std::memcpy(&y, first2, sizeof y);
+        std::memcpy(&z, first3, sizeof z);
+        vint64 ok;
+        const vdouble res = kernel(tag, x, y, z, ok);
+        std::memcpy(out, &res, sizeof res);
+        for (int i = 0 ; i < width ; ++i) {
+            if (!ok[i]) {
+                out[i] = scalar(tag, x[i], y[i], z[i]);
+            }
+        }
+    }
+
+    // Remaining elements
+    for (; first != last ; ++first, ++first2, ++first3, ++out) {
+        *out = scalar(tag, *first, *first2, *first3);
+    }
+}
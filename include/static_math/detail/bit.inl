@@ -22,6 +22,67 @@
  * THE SOFTWARE.
  */
 
+////////////////////////////////////////////////////////////
+// Helper functions
+
+namespace detail
+{
+    // Portable count of trailing zeros of a non-zero x, halving the
+    // width of the searched window at every step
+    template<typename Unsigned>
+    constexpr auto countr_zero_loop(Unsigned x) noexcept
+        -> int
+    {
+        constexpr int digits = std::numeric_limits<Unsigned>::digits;
+
+        int width = 1;
+        while (2 * width < digits) {
+            width *= 2;
+        }
+
+        int res = 0;
+        for (; width > 0 ; width /= 2) {
+            const Unsigned mask = static_cast<Unsigned>(static_cast<Unsigned>(~Unsigned(0)) >> (digits - width));
+            while ((x & mask) == 0) {
+                x >>= width;
+                res += width;
+            }
+        }
+        return res;
+    }
+
+#ifdef STATIC_MATH_HAS_BUILTIN_CTZ
+    // Types that fit in unsigned long long use the builtins, wider
+    // ones are split into unsigned long long chunks
+
+    template<typename Unsigned>
+    constexpr auto countr_zero_builtin(std::true_type, Unsigned x) noexcept
+        -> int
+    {
+        return (sizeof(Unsigned) <= sizeof(unsigned)) ?
+            __builtin_ctz(static_cast<unsigned>(x)) :
+            __builtin_ctzll(static_cast<unsigned long long>(x));
+    }
+
+    template<typename Unsigned>
+    constexpr auto countr_zero_builtin(std::false_type, Unsigned x) noexcept
+        -> int
+    {
+        constexpr int chunk_digits = std::numeric_limits<unsigned long long>::digits;
+
+        int res = 0;
+        while (static_cast<unsigned long long>(x) == 0) {
+            x >>= chunk_digits;
+            res += chunk_digits;
+        }
+        return res + __builtin_ctzll(static_cast<unsigned long long>(x));
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////
+// Power-of-2 functions
+
 template<typename Unsigned>
 constexpr auto ispow2(Unsigned x) noexcept
     -> bool
@@ -106,3 +167,33 @@ constexpr auto log2p1(constant<Unsigned, N>) noexcept
     return {};
 }
 #endif
+
+////////////////////////////////////////////////////////////
+// Bit counting
+
+template<typename Unsigned>
+constexpr auto countr_zero(Unsigned x) noexcept
+    -> int
+{
+    if (x == 0) {
+        return std::numeric_limits<Unsigned>::digits;
+    }
+#ifdef STATIC_MATH_HAS_BUILTIN_CTZ
+    using fits_builtin = std::integral_constant<
+        bool,
+        (std::numeric_limits<Unsigned>::digits <= std::numeric_limits<unsigned long long>::digits)
+    >;
+    return detail::countr_zero_builtin(fits_builtin{}, x);
+#else
+    return detail::countr_zero_loop(x);
+#endif
+}
+
+#ifndef STATIC_MATH_NO_INTEGRAL_CONSTANT
+template<typename Unsigned, Unsigned N>
+constexpr auto countr_zero(constant<Unsigned, N>) noexcept
+    -> constant<int, countr_zero(N)>
+{
+    return {};
+}
+#endif
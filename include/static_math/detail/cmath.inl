@@ -27,21 +27,6 @@
 
 namespace detail
 {
-    // x^n / n!
-    template<typename T>
-    constexpr auto xn_nfac(T x, int n)
-        -> T
-    {
-        return smath::pow(x, n) / detail::factorial<T>(n);
-    }
-
-    template<typename T>
-    constexpr auto trig_helper(T x, int n, bool s)
-        -> T
-    {
-        return s ? detail::xn_nfac(x, n) : -detail::xn_nfac(x, n);
-    }
-
     ////////////////////////////////////////////////////////////
     // pow
 
@@ -58,49 +43,302 @@ namespace detail
     ////////////////////////////////////////////////////////////
     // sqrt
 
-    template<typename T>
-    constexpr auto sqrt_helper(T x, T y)
-        -> decltype(std::sqrt(x))
+    // Quadratic minimax approximation of sqrt on [0.25, 1) accurate
+    // to 7.6 bits, used as the seed of Newton's iteration
+    constexpr auto sqrt_seed()
+        -> polynomial<double, 3>
+    {
+        return {{
+            0.259277313890422478,
+            1.05201938237613703,
+            -0.316320902431531530,
+        }};
+    }
+
+    template<typename Float>
+    constexpr auto sqrt_helper(Float x)
+        -> Float
+    {
+        if (is_nan(x)) {
+            return x;
+        }
+        if (x < 0) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        if (x == 0 || is_inf(x)) {
+            return x;
+        }
+
+        using work_type = reduction_t<Float>;
+
+        // x = 2^e * m with m in [0.25, 1) and e even
+        int e = 0;
+        work_type m = frexp_helper(static_cast<work_type>(x), &e);
+        if (e % 2 != 0) {
+            m /= 2;
+            ++e;
+        }
+
+        // Every Newton step doubles the number of correct bits
+        work_type y = detail::horner(m, sqrt_seed());
+        constexpr int steps = std::numeric_limits<work_type>::digits > 53 ? 3 : 2;
+        for (int i = 0 ; i < steps ; ++i) {
+            y = (y + m / y) / 2;
+        }
+
+        // Last Newton step with an exact residual so that the
+        // result is almost always correctly rounded
+        const float_pair<work_type> sq = two_prod(y, y);
+        y += ((m - sq.hi) - sq.lo) / (2 * y);
+
+        return static_cast<Float>(ldexp_helper(y, e / 2));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // cbrt
+
+    // Cubic minimax approximation of cbrt on [0.125, 1) accurate
+    // to 7.5 bits, used as the seed of Newton's iteration
+    constexpr auto cbrt_seed()
+        -> polynomial<double, 4>
+    {
+        return {{
+            0.340841908623790447,
+            1.45811299010024803,
+            -1.38592483474272920,
+            0.592185072645645389,
+        }};
+    }
+
+    template<typename Float>
+    constexpr auto cbrt_helper(Float x)
+        -> Float
     {
-        return detail::is_close(x, y*y) ? y :
-            sqrt_helper(x, (y + x/y) / 2);
+        if (is_nan(x) || x == 0 || is_inf(x)) {
+            return x;
+        }
+
+        using work_type = reduction_t<Float>;
+
+        // |x| = 2^e * m with m in [0.125, 1) and e a multiple of 3
+        int e = 0;
+        work_type m = frexp_helper(smath::abs(static_cast<work_type>(x)), &e);
+        const int rem = (e % 3 + 3) % 3;
+        if (rem != 0) {
+            m /= pow2<work_type>(3 - rem);
+            e += 3 - rem;
+        }
+
+        // Every Newton step doubles the number of correct bits
+        work_type y = detail::horner(m, cbrt_seed());
+        constexpr int steps = std::numeric_limits<work_type>::digits > 53 ? 3 : 2;
+        for (int i = 0 ; i < steps ; ++i) {
+            y = (2 * y + m / (y * y)) / 3;
+        }
+
+        // Last Newton step with an exact residual so that the
+        // result is almost always correctly rounded
+        const float_pair<work_type> sq = two_prod(y, y);
+        const float_pair<work_type> cube = two_prod(sq.hi, y);
+        const work_type residual = ((cube.hi - m) + cube.lo) + sq.lo * y;
+        y -= residual / (3 * sq.hi);
+
+        const work_type res = ldexp_helper(y, e / 3);
+        return static_cast<Float>(x < 0 ? -res : res);
     }
 
     ////////////////////////////////////////////////////////////
-    // hypot (contributed by Orson Peters)
+    // hypot
+
+    // Operations used by the hypot kernels: the constexpr ones, and
+    // the ones used at runtime when the functions dispatch, which use
+    // the standard library sqrt and a fused multiply-add to compute
+    // exact squares when it is fast; both compute the same squares
+    struct hypot_constexpr_ops
+    {
+        template<typename T>
+        static constexpr auto sqrt(T x)
+            -> T
+        {
+            return sqrt_helper(x);
+        }
+
+        template<typename T>
+        static constexpr auto square(T x)
+            -> float_pair<T>
+        {
+            return two_prod(x, x);
+        }
+    };
+
+    struct hypot_runtime_ops
+    {
+        template<typename T>
+        static auto sqrt(T x)
+            -> T
+        {
+            return std::sqrt(x);
+        }
+
+#ifdef FP_FAST_FMA
+        static auto square(double x)
+            -> float_pair<double>
+        {
+            const double p = x * x;
+            return { p, std::fma(x, x, -p) };
+        }
+#endif
+
+        template<typename T>
+        static auto square(T x)
+            -> float_pair<T>
+        {
+            return two_prod(x, x);
+        }
+    };
+
+    // Bounds of the greatest argument for which the squares and their
+    // sum can be computed without scaling: the sum can't overflow and
+    // the rounding errors of the squares are normal numbers
 
     template<typename T>
-    constexpr auto hypot_impl_var(T s, T t)
+    constexpr auto hypot_unscaled_min()
         -> T
     {
-        return t * smath::sqrt(s);
+        return pow2<T>((std::numeric_limits<T>::min_exponent + 2 * std::numeric_limits<T>::digits) / 2);
     }
 
-    template<typename T, typename... Args>
-    constexpr auto hypot_impl_var(T s, T t, T x, Args... args)
+    template<typename T>
+    constexpr auto hypot_unscaled_max()
         -> T
     {
-        return t < x  ? hypot_impl_var(T(1) + s * ((t/x)*(t/x)), x, args...) :
-               t != 0 ? hypot_impl_var(s + (x/t)*(x/t), t, args...) :
-                        hypot_impl_var(s, t, args...);
+        return pow2<T>((std::numeric_limits<T>::max_exponent - std::numeric_limits<T>::digits) / 2);
     }
 
-    template<typename T>
-    constexpr auto hypot_impl(T x, T y)
+    // Adds the exact square of x to the unevaluated sum acc
+    template<typename Ops, typename T>
+    constexpr auto hypot_add_square(Ops, float_pair<T> acc, T x)
+        -> float_pair<T>
+    {
+        const float_pair<T> sq = Ops::square(x);
+        const float_pair<T> sum = two_sum(acc.hi, sq.hi);
+        return { sum.hi, sum.lo + (acc.lo + sq.lo) };
+    }
+
+    // Square root of an unevaluated sum of squares, corrected with
+    // the exact residual of the square of the seed
+    template<typename Ops, typename T>
+    constexpr auto hypot_finish(Ops, float_pair<T> sum)
+        -> T
+    {
+        const T r = Ops::sqrt(sum.hi);
+        const float_pair<T> sq = Ops::square(r);
+        return r + (((sum.hi - sq.hi) - sq.lo) + sum.lo) / (2 * r);
+    }
+
+    // General kernel: handles infinities and NaNs, and scales the
+    // arguments by the exponent of the greatest of them when needed,
+    // which is exact and avoids both overflow and loss of accuracy
+    // to underflow without any division
+    template<typename Ops, typename T, std::size_t N>
+    constexpr auto hypot_scaled(Ops ops, const T (&values)[N])
+        -> T
+    {
+        T m = 0;
+        bool has_nan = false;
+        for (T value: values) {
+            if (is_inf(value)) {
+                return std::numeric_limits<T>::infinity();
+            }
+            has_nan = has_nan || is_nan(value);
+            m = (m < value) ? value : m;
+        }
+        if (has_nan) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (m == 0) {
+            return 0;
+        }
+
+        int e = 0;
+        T scale = 1;
+        if (m < hypot_unscaled_min<T>() || m > hypot_unscaled_max<T>()) {
+            // Clamp e so that 2^-e and 2^e stay normal
+            constexpr int min_exponent = std::numeric_limits<T>::min_exponent;
+            constexpr int max_exponent = std::numeric_limits<T>::max_exponent - 2;
+            frexp_helper(m, &e);
+            e = (e < min_exponent) ? min_exponent :
+                (e > max_exponent) ? max_exponent :
+                                     e;
+            scale = pow2<T>(-e);
+        }
+
+        float_pair<T> sum = { 0, 0 };
+        for (T value: values) {
+            sum = hypot_add_square(ops, sum, value * scale);
+        }
+        return ldexp_helper(hypot_finish(ops, sum), e);
+    }
+
+    // Types narrower than their reduction type: the squares and
+    // their sum are computed in the wider type, where they can't
+    // overflow and are exact or almost exact
+    template<typename Ops, typename T, typename... Args>
+    constexpr auto hypot_impl(std::false_type, Ops, T x, Args... args)
+        -> T
+    {
+        using work_type = reduction_t<T>;
+
+        const T values[] = { x, args... };
+        work_type sum = 0;
+        bool has_inf = false;
+        for (T value: values) {
+            has_inf = has_inf || is_inf(value);
+            sum += static_cast<work_type>(value) * value;
+        }
+        if (has_inf) {
+            return std::numeric_limits<T>::infinity();
+        }
+        return static_cast<T>(Ops::sqrt(sum));
+    }
+
+    // Specialised kernels for two and three arguments, which only
+    // fall back to the general kernel when the greatest argument is
+    // not in the range where no scaling is needed; comparisons with
+    // NaN being false, this also catches NaN arguments
+
+    template<typename Ops, typename T>
+    constexpr auto hypot_impl(std::true_type, Ops ops, T x, T y)
+        -> T
+    {
+        const T m = (x < y) ? y : x;
+        if (x <= m && y <= m && m >= hypot_unscaled_min<T>() && m <= hypot_unscaled_max<T>()) {
+            return hypot_finish(ops, hypot_add_square(ops, Ops::square(x), y));
+        }
+        const T values[] = { x, y };
+        return hypot_scaled(ops, values);
+    }
+
+    template<typename Ops, typename T>
+    constexpr auto hypot_impl(std::true_type, Ops ops, T x, T y, T z)
         -> T
     {
-        return x < y  ? y * smath::sqrt(T(1) + (x/y)*(x/y)) :
-               x != 0 ? x * smath::sqrt(T(1) + (y/x)*(y/x)) :
-                        0;
+        const T mxy = (x < y) ? y : x;
+        const T m = (mxy < z) ? z : mxy;
+        if (x <= m && y <= m && z <= m && m >= hypot_unscaled_min<T>() && m <= hypot_unscaled_max<T>()) {
+            float_pair<T> sum = hypot_add_square(ops, Ops::square(x), y);
+            return hypot_finish(ops, hypot_add_square(ops, sum, z));
+        }
+        const T values[] = { x, y, z };
+        return hypot_scaled(ops, values);
     }
 
-    template<typename T, typename... Args>
-    constexpr auto hypot_impl(T x, T y, Args... args)
+    template<typename Ops, typename T, typename... Args>
+    constexpr auto hypot_impl(std::true_type, Ops ops, T x, T y, T z, T w, Args... args)
         -> T
     {
-        return x < y  ? hypot_impl_var(T(1) + (x/y)*(x/y), y, args...) :
-               x != 0 ? hypot_impl_var(T(1) + (y/x)*(y/x), x, args...) :
-                        hypot_impl_var(T(1), T(0), args...);
+        const T values[] = { x, y, z, w, args... };
+        return hypot_scaled(ops, values);
     }
 
     template<typename... Args>
@@ -108,61 +346,156 @@ namespace detail
         decltype(std::fabs(std::declval<Args>()))...
     >;
 
+    template<typename Ops, typename... Args>
+    constexpr auto hypot_kernel(Ops ops, Args... args)
+        -> common_ftype_t<Args...>
+    {
+        using float_type = common_ftype_t<Args...>;
+        return hypot_impl(std::is_same<reduction_t<float_type>, float_type>{}, ops,
+                          smath::abs(static_cast<float_type>(args))...);
+    }
+
     template<typename... Args>
     constexpr auto hypot_helper(Args... args)
         -> common_ftype_t<Args...>
     {
-        return hypot_impl(smath::abs(common_ftype_t<Args...>(args))...);
+        return hypot_kernel(hypot_constexpr_ops{}, args...);
     }
 
     ////////////////////////////////////////////////////////////
-    // exp (contributed by theLOLflashlight)
-
-    constexpr std::size_t exp_max_depth = 50;
+    // exp
 
-    template<std::size_t N>
-    struct exponential
+    // exp(x + dx) for a type with the given precision, dx being a
+    // correction small compared to x; the result must be finite
+    template<int Digits, typename T>
+    constexpr auto exp_kernel(T x, T dx)
+        -> T
     {
-        exponential() = delete;
+        using split = ln2_split<std::numeric_limits<T>::digits>;
+
+        // x = k ln(2) + r with |r| <= ln(2)/2
+        const T t = x * constants::log2e<T>;
+        const int k = static_cast<int>(t < 0 ? t - T(0.5) : t + T(0.5));
+        const auto dk = static_cast<T>(k);
+        const T hi = x - dk * split::hi;
+        const T lo = dk * split::lo - dx;
+        const T r = hi - lo;
+
+        // exp(r) = 1 + 2r / (R(r) - r) with R(r) = r coth(r/2)
+        const T z = r * r;
+        const T c = r - z * evaluate(z, exp_minimax<Digits>::coefficients());
+        const T y = 1 - ((lo - (r * c) / (2 - c)) - hi);
+        return ldexp_helper(y, k);
+    }
 
-        static_assert(N < exp_max_depth, "exceeded maximum recursion depth");
+    template<typename Float>
+    constexpr auto exp_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
 
-        template<typename T>
-        static constexpr auto compute(T x)
-            -> T
-        {
-            const auto epsilon = std::numeric_limits<T>::epsilon() * x;
-            const T term = xn_nfac(x, N);
+        if (is_nan(x)) {
+            return x;
+        }
+        // Results out of the range of Float, also keeps k in the
+        // range of int
+        if (x > std::numeric_limits<Float>::max_exponent * constants::ln2<Float>) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        constexpr int min_exponent = std::numeric_limits<Float>::min_exponent - digits - 1;
+        if (x < min_exponent * constants::ln2<Float>) {
+            return Float(0);
+        }
 
-            if (term < epsilon)
-            {
-                return term;
-            }
-            else
-            {
-                return term + exponential<N + 1>::compute(x);
-            }
+        const work_type res = exp_kernel<digits>(static_cast<work_type>(x), work_type(0));
+        if (res > std::numeric_limits<Float>::max()) {
+            return std::numeric_limits<Float>::infinity();
         }
-    };
+        return static_cast<Float>(res);
+    }
 
-    template<>
-    struct exponential<exp_max_depth>
+    // 2^(k + r + dr) for a type with the given precision, with r in
+    // [-1/2, 1/2] and dr a correction small compared to r: 2^r is
+    // computed as exp(r ln(2)) with the product carried with twice
+    // the precision of the type, then k is added to its exponent
+    template<int Digits, typename T>
+    constexpr auto exp2_kernel(int k, T r, T dr)
+        -> T
     {
-        exponential() = delete;
+        using split = ln2_split<std::numeric_limits<T>::digits>;
 
-        template<typename T>
-        static constexpr auto compute(T)
-            -> T
-        {
-            return T();
+        const float_pair<T> p = two_prod(r, split::hi);
+        const T y = exp_kernel<Digits>(p.hi, p.lo + (r * split::lo + dr * split::hi));
+        return ldexp_helper(y, k);
+    }
+
+    template<typename Float>
+    constexpr auto exp2_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        if (x >= std::numeric_limits<Float>::max_exponent) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        if (x < std::numeric_limits<Float>::min_exponent - digits - 1) {
+            return Float(0);
         }
-    };
 
-    template<std::size_t N, typename T>
-    constexpr auto exp_helper(T x)
-        -> T
+        // x = k + r with |r| <= 1/2, r being exact
+        const auto wx = static_cast<work_type>(x);
+        const int k = static_cast<int>(wx < 0 ? wx - work_type(0.5) : wx + work_type(0.5));
+        const work_type res = exp2_kernel<digits>(k, wx - k, work_type(0));
+        if (res > std::numeric_limits<Float>::max()) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        return static_cast<Float>(res);
+    }
+
+    // exp10(x) = 2^(x log2(10)), the product being computed with twice
+    // the precision of the type before being split into an integer and
+    // a fractional part
+    template<typename Float>
+    constexpr auto exp10_helper(Float x)
+        -> Float
     {
-        return exponential<N>::compute(x);
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        constexpr int max_exponent = std::numeric_limits<Float>::max_exponent;
+        constexpr int min_exponent = std::numeric_limits<Float>::min_exponent - digits - 1;
+        using log2_10 = log2_10_split<std::numeric_limits<work_type>::digits>;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        // log2(10) > 1, also keeps the product below from overflowing
+        if (x >= max_exponent) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        if (x < min_exponent) {
+            return Float(0);
+        }
+
+        const auto wx = static_cast<work_type>(x);
+        const float_pair<work_type> t = two_prod(wx, log2_10::hi);
+        if (t.hi >= max_exponent) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        if (t.hi < min_exponent) {
+            return Float(0);
+        }
+
+        const int k = static_cast<int>(t.hi < 0 ? t.hi - work_type(0.5) : t.hi + work_type(0.5));
+        const work_type res = exp2_kernel<digits>(k, t.hi - k, t.lo + wx * log2_10::lo);
+        if (res > std::numeric_limits<Float>::max()) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        return static_cast<Float>(res);
     }
 
     ////////////////////////////////////////////////////////////
@@ -211,112 +544,167 @@ namespace detail
         return ilogarithm<Base>::compute(N);
     }
 
-    template<std::size_t N>
-    struct logarithm_lte2
+    // k ln(2) + log(1 + f) + c for f in [sqrt(1/2) - 1, sqrt(2) - 1]
+    // and a type with the given precision, c being a correction small
+    // compared to f
+    template<int Digits, typename T>
+    constexpr auto log_kernel(T f, int k, T c)
+        -> T
     {
-        logarithm_lte2() = delete;
+        using split = ln2_split<std::numeric_limits<T>::digits>;
+
+        const auto dk = static_cast<T>(k);
+        const T hfsq = f * f / 2;
+        const T s = f / (2 + f);
+        const T z = s * s;
+        const T r = z * evaluate(z, log_minimax<Digits>::coefficients());
+        return dk * split::hi + (f - (hfsq - (s * (hfsq + r) + (dk * split::lo + c))));
+    }
 
-        template<typename Float>
-        static constexpr auto compute(Float x)
-            -> decltype(std::log(x))
-        {
-            // Use ln x = \sigma (-1)^(N+1)/ N * (x - 1)^(N)
-            const Float term = (pow_helper(-1.0, N + 1) / N) * pow_helper(x - 1.0, N);
+    // Logarithms of the arguments that aren't finite and positive
+    template<typename Float>
+    constexpr auto is_log_special(Float x)
+        -> bool
+    {
+        return is_nan(x) || x <= 0 || is_inf(x);
+    }
 
-            return term + logarithm_lte2<N + 1>::compute(x);
+    template<typename Float>
+    constexpr auto log_special(Float x)
+        -> Float
+    {
+        if (x < 0) {
+            return std::numeric_limits<Float>::quiet_NaN();
         }
-    };
+        if (x == 0) {
+            return -std::numeric_limits<Float>::infinity();
+        }
+        return x;
+    }
 
-    template<>
-    struct logarithm_lte2<log_max_depth>
+    template<typename Float>
+    constexpr auto logf_helper(Float x)
+        -> Float
     {
-        logarithm_lte2() = delete;
+        if (is_log_special(x)) {
+            return log_special(x);
+        }
 
-        template<typename Float>
-        static constexpr auto compute(Float x)
-            -> decltype(std::log(x))
-        {
-            (void) x;
-            return Float(0);
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        // x = 2^k * m with m in [sqrt(1/2), sqrt(2))
+        int k = 0;
+        work_type m = frexp_helper(static_cast<work_type>(x), &k);
+        if (m < constants::sqrt1_2<work_type>) {
+            m *= 2;
+            --k;
         }
-    };
+        return static_cast<Float>(log_kernel<digits>(m - 1, k, work_type(0)));
+    }
 
     template<typename Float>
-    static constexpr auto get_fast_converge_params(Float* const A, std::size_t* const n, Float x)
-        -> void
+    constexpr auto log1p_helper(Float x)
+        -> Float
     {
-        auto _x = static_cast<std::size_t>(trunc(x));
-        auto _n = static_cast<std::size_t>(logi_helper<10>(_x));
-        *n = _n;
-        *A = x / pow_helper(10, _n);
+        if (is_nan(x) || x == 0) {
+            return x;
+        }
+        if (x < -1) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        if (x == -1) {
+            return -std::numeric_limits<Float>::infinity();
+        }
+        if (is_inf(x)) {
+            return x;
+        }
+
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        // 1 + x = 2^k * (1 + f) with 1 + f in [sqrt(1/2), sqrt(2)); when
+        // k is 0, f is x itself and doesn't suffer from the rounding of
+        // 1 + x, otherwise c corrects that rounding, the subtractions
+        // being exact on both sides of 2
+        const auto wx = static_cast<work_type>(x);
+        const work_type u = 1 + wx;
+        int k = 0;
+        work_type m = frexp_helper(u, &k);
+        if (m < constants::sqrt1_2<work_type>) {
+            m *= 2;
+            --k;
+        }
+        if (k == 0) {
+            return static_cast<Float>(log_kernel<digits>(wx, 0, work_type(0)));
+        }
+        const work_type c = (u >= 2 ? 1 - (u - wx) : wx - (u - 1)) / u;
+        return static_cast<Float>(log_kernel<digits>(m - 1, k, c));
     }
 
-    template<std::size_t N>
-    struct fast_converge_log
+    // log2(x) for a finite positive x and a type with the given precision,
+    // returned as an unevaluated sum: with x = 2^k m, log(m) = hi + lo
+    // where hi holds half of the bits of the type, so that its product
+    // with the split of log2(e) is exact and only the small terms of the
+    // result are rounded before the exact addition of k
+    template<int Digits, typename T>
+    constexpr auto log2_pair(T x)
+        -> float_pair<T>
     {
-        fast_converge_log() = delete;
-
-        template<typename Float>
-        static constexpr auto compute(Float x)
-            -> Float
-        {
-            Float a(0);
-            std::size_t n(0);
-
-            get_fast_converge_params(&a, &n, x);
-
-            const Float y = (a - 1.0) / (a + 1.0);
+        using log2e = log2e_split<std::numeric_limits<T>::digits>;
 
-            return n * constants::ln10<Float> + 2.0 * fast_converge_log<0>::S(y);
+        int k = 0;
+        T m = frexp_helper(x, &k);
+        if (m < constants::sqrt1_2<T>) {
+            m *= 2;
+            --k;
         }
 
-        template<typename Float>
-        static constexpr auto S(Float y)
-            -> Float
-        {
-            const auto nnp1 = 2 * N + 1;
-            const auto term = (pow_helper(y, nnp1) / nnp1);
+        // log(m) = f - hfsq + r
+        const T f = m - 1;
+        const T hfsq = f * f / 2;
+        const T s = f / (2 + f);
+        const T z = s * s;
+        const T r = s * (hfsq + z * evaluate(z, log_minimax<Digits>::coefficients()));
+        const T hi = split(f - hfsq).hi;
+        const T lo = ((f - hi) - hfsq) + r;
+
+        const float_pair<T> res = two_sum(static_cast<T>(k), hi * log2e::hi);
+        return { res.hi, res.lo + ((lo + hi) * log2e::lo + lo * log2e::hi) };
+    }
 
-            return term + fast_converge_log<N+1>::S(y);
+    template<typename Float>
+    constexpr auto log2f_helper(Float x)
+        -> Float
+    {
+        if (is_log_special(x)) {
+            return log_special(x);
         }
-    };
 
-    template<>
-    struct fast_converge_log<log_max_depth>
-    {
-        fast_converge_log() = delete;
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
 
-        template<typename Float>
-        static constexpr auto S(Float)
-            -> Float
-        {
-            return Float(0);
-        }
-    };
+        const float_pair<work_type> res = log2_pair<digits>(static_cast<work_type>(x));
+        return static_cast<Float>(res.hi + res.lo);
+    }
 
-    template<
-        typename Float,
-        typename = std::enable_if_t<std::is_floating_point<Float>::value>
-    >
-    static constexpr auto logf_helper(Float x)
-        -> decltype(std::log(x))
+    // log10(x) = log2(x) log10(2), the product being computed with
+    // the extra precision of both operands
+    template<typename Float>
+    constexpr auto log10f_helper(Float x)
+        -> Float
     {
-        if (x < Float(0))
-        {
-            return std::numeric_limits<Float>::quiet_NaN();
-        }
-        else if (is_close(x, Float(0)))
-        {
-            return -1.0 * std::numeric_limits<Float>::infinity();
-        }
-        else if (x < 2.0)
-        {
-            return logarithm_lte2<1>::compute(x);
-        }
-        else
-        {
-            return fast_converge_log<0>::compute(x);
+        if (is_log_special(x)) {
+            return log_special(x);
         }
+
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        using log10_2 = log10_2_split<std::numeric_limits<work_type>::digits>;
+
+        const float_pair<work_type> l = log2_pair<digits>(static_cast<work_type>(x));
+        const float_pair<work_type> p = two_prod(l.hi, log10_2::hi);
+        return static_cast<Float>(p.hi + (p.lo + (l.hi * log10_2::lo + l.lo * log10_2::hi)));
     }
 
     template<typename Float>
@@ -330,7 +718,12 @@ namespace detail
     constexpr auto log10_helper(std::true_type, Float x)
         -> decltype(std::log10(x))
     {
-        return detail::logf_helper(x) / constants::ln10<Float>;
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+        if (!detail::is_constant_evaluated()) {
+            return std::log10(x);
+        }
+#endif
+        return detail::log10f_helper(x);
     }
 
     template<typename Float>
@@ -351,7 +744,12 @@ namespace detail
     constexpr auto log2_helper(std::true_type, Float x)
         -> decltype(std::log2(x))
     {
-        return detail::logf_helper(x) / constants::ln2<Float>;
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+        if (!detail::is_constant_evaluated()) {
+            return std::log2(x);
+        }
+#endif
+        return detail::log2f_helper(x);
     }
 
     template<typename Float>
@@ -360,130 +758,1164 @@ namespace detail
     {
         return log2_helper(std::is_floating_point<Float>{}, x);
     }
-    ////////////////////////////////////////////////////////////
-    // sin & sinh (contributed by theLOLflashlight)
 
-    constexpr std::size_t sin_max_depth = 51;
-    static_assert(detail::is_odd(sin_max_depth), "");
+    ////////////////////////////////////////////////////////////
+    // Rounding to an integer value
 
-    template<std::size_t N>
-    struct sine
+    // Adding and subtracting 2^(p-1) rounds the magnitude of x to
+    // the nearest integer without leaving the floating point type,
+    // and every number larger than that is already an integer; the
+    // sign of x is copied back so that zeros keep their sign
+    template<typename T>
+    constexpr auto trunc_helper(T x)
+        -> T
     {
-        sine() = delete;
+        constexpr T big = pow2<T>(std::numeric_limits<T>::digits - 1);
+        const T a = (x < 0) ? -x : x;
+        // Also returns NaN unchanged
+        if (!(a < big)) {
+            return x;
+        }
+        const T rounded = (a + big) - big;
+        const T res = (rounded > a) ? rounded - 1 : rounded;
+        return sign_bit(x) ? -res : res;
+    }
 
-        static_assert(detail::is_odd(N), "N must be odd for sin functions");
-        static_assert(N < sin_max_depth, "exceeded maximum recursion depth");
+    template<typename T>
+    constexpr auto floor_helper(T x)
+        -> T
+    {
+        const T res = trunc_helper(x);
+        return (res > x) ? res - 1 : res;
+    }
 
-        template<typename T>
-        static constexpr auto trig(T x)
-            -> T
-        {
-            return trig_helper(x, N, detail::is_even((N - 1) / 2)) + sine<N + 2>::trig(x);
-        }
+    template<typename T>
+    constexpr auto ceil_helper(T x)
+        -> T
+    {
+        const T res = trunc_helper(x);
+        return (res < x) ? res + 1 : res;
+    }
 
-        template<typename T>
-        static constexpr auto hyper(T x)
-            -> T
-        {
-            return xn_nfac(x, N) + sine<N + 2>::hyper(x);
-        }
-    };
+    // x - trunc(x) is exact, which avoids the double rounding
+    // of x + 0.5 for the predecessor of 0.5 and large odd numbers
+    template<typename T>
+    constexpr auto round_helper(T x)
+        -> T
+    {
+        const T res = trunc_helper(x);
+        const T diff = x - res;
+        return (diff >= T(0.5)) ? res + 1 :
+            (diff <= T(-0.5)) ? res - 1 :
+                res;
+    }
 
-    template<>
-    struct sine<sin_max_depth>
+    ////////////////////////////////////////////////////////////
+    // Floating point remainders
+
+    // |x| mod |y| for finite x and non-zero y, along with the low
+    // bits of the quotient: y is scaled by the greatest power of 2
+    // that keeps it lesser than x, then subtracted and halved back
+    // like in a binary long division; every subtraction is exact
+    // since it happens between numbers within a factor 2 of each
+    // other, and so is the halving of a scaled y
+    template<typename T>
+    constexpr auto fmod_abs(T x, T y, unsigned* quo)
+        -> T
     {
-        sine() = delete;
+        const T b = (y < 0) ? -y : y;
+        T a = (x < 0) ? -x : x;
+        *quo = 0;
+        if (is_inf(b) || a < b) {
+            return a;
+        }
 
-        template<typename T>
-        static constexpr auto trig(T)
-            -> T
-        {
-            return T();
+        int exp_a = 0;
+        int exp_b = 0;
+        frexp_helper(a, &exp_a);
+        frexp_helper(b, &exp_b);
+        T scaled = ldexp_helper(b, exp_a - exp_b);
+        if (scaled > a) {
+            scaled /= 2;
         }
 
-        template<typename T>
-        static constexpr auto hyper(T)
-            -> T
-        {
-            return T();
+        unsigned q = 0;
+        while (scaled >= b) {
+            q <<= 1;
+            if (a >= scaled) {
+                a -= scaled;
+                q |= 1u;
+            }
+            scaled /= 2;
+        }
+        *quo = q;
+        return a;
+    }
+
+    template<typename T>
+    constexpr auto is_remainder_special(T x, T y)
+        -> bool
+    {
+        return is_nan(x) || is_nan(y) || is_inf(x) || y == 0;
+    }
+
+    template<typename T>
+    constexpr auto fmod_helper(T x, T y)
+        -> T
+    {
+        if (is_remainder_special(x, y)) {
+            return (is_nan(x) || is_nan(y)) ? x + y : std::numeric_limits<T>::quiet_NaN();
+        }
+        unsigned quo = 0;
+        const T res = fmod_abs(x, y, &quo);
+        return sign_bit(x) ? -res : res;
+    }
+
+    // Rounds the quotient to nearest, ties to even, from the result
+    // of fmod_abs; r > |y| - r compares r to |y| / 2 without the
+    // rounding of a subnormal |y| / 2 and without overflowing 2r
+    template<typename T>
+    constexpr auto remquo_helper(T x, T y, int* quo)
+        -> T
+    {
+        *quo = 0;
+        if (is_remainder_special(x, y)) {
+            return (is_nan(x) || is_nan(y)) ? x + y : std::numeric_limits<T>::quiet_NaN();
+        }
+
+        // Only the three low bits of the truncated quotient are
+        // kept before rounding it, which is the minimum required by
+        // the standard and matches glibc
+        unsigned q = 0;
+        T res = fmod_abs(x, y, &q);
+        q &= 7u;
+        const T b = (y < 0) ? -y : y;
+        if (!is_inf(b)) {
+            const T half_diff = b - res;
+            if (res > half_diff || (res == half_diff && (q & 1u))) {
+                res = -half_diff;
+                ++q;
+            }
+        }
+
+        const int low_bits = static_cast<int>(q);
+        *quo = (sign_bit(x) != sign_bit(y)) ? -low_bits : low_bits;
+        return sign_bit(x) ? -res : res;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // pow with a real exponent
+
+    // Whether x holds an integer value, without converting it to an
+    // integer type that could overflow
+    template<typename T>
+    constexpr auto is_integer_value(T x)
+        -> bool
+    {
+        return trunc_helper(x) == x;
+    }
+
+    template<typename T>
+    constexpr auto is_odd_integer_value(T x)
+        -> bool
+    {
+        return is_integer_value(x) && !is_integer_value(x / 2);
+    }
+
+    // Precision of the minimax kernels to use for a type with the
+    // given precision when the error of the kernels has to be
+    // negligible compared to the precision of the type
+    constexpr auto extended_digits(int digits)
+        -> int
+    {
+        return digits < 53 ? 53 : digits < 64 ? 64 : 113;
+    }
+
+    // log(x) for a finite positive x and a type with the given precision,
+    // returned as an unevaluated sum with about twice the precision of
+    // the type: with x = 2^k m, log(m) = 2s + c0 s^3 + s^5 Q(s^2) where
+    // s = (m - 1) / (m + 1), every term but the last one is computed
+    // along with its rounding error and the polynomial is the one of
+    // a more precise type
+    template<int Digits, typename T>
+    constexpr auto log_pair(T x)
+        -> float_pair<T>
+    {
+        using split = ln2_split<std::numeric_limits<T>::digits>;
+
+        int k = 0;
+        T m = frexp_helper(x, &k);
+        if (m < constants::sqrt1_2<T>) {
+            m *= 2;
+            --k;
+        }
+
+        // s + slo = (m - 1) / (m + 1), m - 1 being exact
+        const T f = m - 1;
+        const float_pair<T> d = two_sum(m, T(1));
+        const T s = f / d.hi;
+        const float_pair<T> sd = two_prod(s, d.hi);
+        const T slo = (((f - sd.hi) - sd.lo) - s * d.lo) / d.hi;
+
+        // s^3 and c0 s^3 with their rounding errors, c0 being more
+        // precise than T
+        const float_pair<T> z = two_prod(s, s);
+        const float_pair<T> s3 = two_prod(s, z.hi);
+        const T s3lo = s3.lo + s * z.lo + 3 * z.hi * slo;
+        constexpr auto poly = log_minimax<extended_digits(Digits)>::coefficients();
+        constexpr std::size_t size = sizeof(poly.coefficients) / sizeof(poly.coefficients[0]);
+        const auto c0 = static_cast<T>(poly.coefficients[0]);
+        const auto c0lo = static_cast<T>(poly.coefficients[0] - c0);
+        const float_pair<T> c = two_prod(s3.hi, c0);
+
+        T q = poly.coefficients[size - 1];
+        for (std::size_t i = size - 1 ; i > 1 ; --i) {
+            q = q * z.hi + poly.coefficients[i - 1];
+        }
+        const T tail = 2 * slo + c.lo + (s3lo * c0 + s3.hi * c0lo) + s3.hi * z.hi * q;
+
+        // k ln(2) + 2s + c0 s^3, then the sum is normalized
+        const auto dk = static_cast<T>(k);
+        const float_pair<T> lm = two_sum(2 * s, c.hi);
+        const float_pair<T> hi = two_sum(dk * split::hi, lm.hi);
+        const T lo = hi.lo + (lm.lo + (dk * split::lo + tail));
+        return two_sum(hi.hi, lo);
+    }
+
+    // x^y for finite non-zero x and y with x^y being a real number:
+    // exp(y log(x)) where log(x) and its product with y are computed
+    // with extra precision since the error on y log(x) is magnified
+    // by the magnitude of y log(x) once passed to exp
+    template<typename Float>
+    constexpr auto pow_real(Float x, Float y)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        constexpr Float infinity = std::numeric_limits<Float>::infinity();
+
+        const bool negative = x < 0 && is_odd_integer_value(y);
+        const work_type a = smath::abs(static_cast<work_type>(x));
+        const auto wy = static_cast<work_type>(y);
+
+        // Integer and half-integer exponents close to zero don't need
+        // exp and log, as long as the intermediate results can't
+        // overflow or underflow
+        int e = 0;
+        frexp_helper(a, &e);
+        if (e > std::numeric_limits<Float>::min_exponent / 2 && e < std::numeric_limits<Float>::max_exponent / 2) {
+            work_type res = 0;
+            if (wy == 1 || wy == -1) {
+                res = a;
+            } else if (wy == 2 || wy == -2) {
+                res = a * a;
+            } else if (wy == work_type(0.5) || wy == work_type(-0.5)) {
+                res = sqrt_helper(a);
+            } else if (wy == work_type(1.5) || wy == work_type(-1.5)) {
+                res = a * sqrt_helper(a);
+            }
+            if (res != 0) {
+                if (wy < 0) {
+                    res = 1 / res;
+                }
+                return static_cast<Float>(negative ? -res : res);
+            }
+        }
+
+        const float_pair<work_type> l = log_pair<digits>(a);
+        const float_pair<work_type> p = two_prod(wy, l.hi);
+        const float_pair<work_type> t = two_sum(p.hi, p.lo + wy * l.lo);
+
+        // Same bounds as exp_helper
+        if (t.hi > std::numeric_limits<Float>::max_exponent * constants::ln2<work_type>) {
+            return negative ? -infinity : infinity;
+        }
+        constexpr int min_exponent = std::numeric_limits<Float>::min_exponent - digits - 1;
+        if (t.hi < min_exponent * constants::ln2<work_type>) {
+            return negative ? -Float(0) : Float(0);
+        }
+
+        const work_type res = exp_kernel<digits>(t.hi, t.lo);
+        if (res > std::numeric_limits<Float>::max()) {
+            return negative ? -infinity : infinity;
+        }
+        return static_cast<Float>(negative ? -res : res);
+    }
+
+    template<typename Float>
+    constexpr auto pow_real_helper(Float x, Float y)
+        -> Float
+    {
+        constexpr Float infinity = std::numeric_limits<Float>::infinity();
+
+        if (y == 0 || x == 1) {
+            return Float(1);
+        }
+        if (is_nan(x) || is_nan(y)) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        if (is_inf(y)) {
+            const Float a = smath::abs(x);
+            if (a == 1) {
+                return Float(1);
+            }
+            return (a > 1) == (y > 0) ? infinity : Float(0);
+        }
+        if (x == 0 || is_inf(x)) {
+            // 0^y and inf^y only depend on the sign of y, and on the
+            // sign of x when y is an odd integer
+            const bool large = (x == 0) == (y < 0);
+            const Float res = large ? infinity : Float(0);
+            return (sign_bit(x) && is_odd_integer_value(y)) ? -res : res;
+        }
+        if (x < 0 && !is_integer_value(y)) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        // |log(x)| is at least about 2^-digits when |x| != 1, so past
+        // this magnitude x^y overflows or underflows whatever x, and
+        // splitting y for the extended precision product would
+        // overflow anyway
+        constexpr Float huge = Float(65536) / std::numeric_limits<Float>::epsilon();
+        if (smath::abs(y) > huge) {
+            const Float a = smath::abs(x);
+            const Float res = (a == 1) ? Float(1) : (a > 1) == (y > 0) ? infinity : Float(0);
+            return (x < 0 && is_odd_integer_value(y)) ? -res : res;
+        }
+        return pow_real(x, y);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // expm1
+
+    // exp(x) - 1 for a type with the given precision, without the
+    // cancellation of exp(x) - 1 near 0; x must be small enough for
+    // the result to be finite
+    template<int Digits, typename T>
+    constexpr auto expm1_kernel(T x)
+        -> T
+    {
+        using split = ln2_split<std::numeric_limits<T>::digits>;
+
+        // x = k ln(2) + r with |r| <= ln(2)/2, c being the
+        // rounding error of r
+        int k = 0;
+        T r = x;
+        T c = 0;
+        if (smath::abs(x) > constants::ln2<T> / 2) {
+            const T t = x * constants::log2e<T>;
+            k = static_cast<int>(t < 0 ? t - T(0.5) : t + T(0.5));
+            const auto dk = static_cast<T>(k);
+            const T hi = x - dk * split::hi;
+            const T lo = dk * split::lo;
+            r = hi - lo;
+            c = (hi - r) - lo;
+        }
+
+        // expm1(r) = r + r^2/2 + e with e computed from
+        // R1(r) = 6/r (coth(r/2) - 2/r)
+        const T hfx = r / 2;
+        const T hxs = r * hfx;
+        const T r1 = 1 + hxs * evaluate(hxs, expm1_minimax<Digits>::coefficients());
+        const T t = 3 - r1 * hfx;
+        T e = hxs * ((r1 - t) / (6 - r * t));
+        if (k == 0) {
+            return r - (r * e - hxs);
+        }
+
+        // expm1(x) = 2^k (expm1(r) + 1) - 1, ordering the operations
+        // to avoid cancellations for every k
+        e = r * (e - c) - c;
+        e -= hxs;
+        if (k == -1) {
+            return (r - e) / 2 - T(0.5);
+        }
+        if (k == 1) {
+            return r < T(-0.25) ? -2 * (e - (r + T(0.5))) : 1 + 2 * (r - e);
+        }
+        if (k <= -2 || k > std::numeric_limits<T>::digits + 3) {
+            return ldexp_helper(1 - (e - r), k) - 1;
+        }
+        if (k < 20) {
+            return ldexp_helper((1 - pow2<T>(-k)) - (e - r), k);
+        }
+        return ldexp_helper((r - (e + pow2<T>(-k))) + 1, k);
+    }
+
+    template<typename Float>
+    constexpr auto expm1_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x) || x == 0) {
+            return x;
+        }
+        // Same bounds as exp_helper, exp(x) rounding to 0 below
+        // the lower one
+        if (x > std::numeric_limits<Float>::max_exponent * constants::ln2<Float>) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        if (x < -(digits + 2) * constants::ln2<Float>) {
+            return Float(-1);
+        }
+
+        const work_type res = expm1_kernel<digits>(static_cast<work_type>(x));
+        if (res > std::numeric_limits<Float>::max()) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        return static_cast<Float>(res);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // sinh, cosh & tanh
+
+    // Past this magnitude, exp(-|x|) doesn't contribute to sinh and
+    // cosh anymore and tanh rounds to +-1
+    template<typename Float>
+    constexpr auto hyper_saturation()
+        -> reduction_t<Float>
+    {
+        return (std::numeric_limits<Float>::digits + 2) * constants::ln2<reduction_t<Float>> / 2;
+    }
+
+    // h exp(a) for a past the saturation threshold, computed as
+    // (h w) w with w = exp(a/2) so that it doesn't overflow before
+    // the result does
+    template<typename Float>
+    constexpr auto hyper_large(reduction_t<Float> a, reduction_t<Float> h)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        constexpr Float infinity = std::numeric_limits<Float>::infinity();
+
+        if (a > (std::numeric_limits<Float>::max_exponent + 1) * constants::ln2<work_type>) {
+            return h < 0 ? -infinity : infinity;
+        }
+        const work_type w = 1 + expm1_kernel<digits>(a / 2);
+        const work_type t = h * w;
+        if (smath::abs(t) > std::numeric_limits<work_type>::max() / w) {
+            return h < 0 ? -infinity : infinity;
+        }
+        const work_type res = t * w;
+        if (smath::abs(res) > std::numeric_limits<Float>::max()) {
+            return h < 0 ? -infinity : infinity;
+        }
+        return static_cast<Float>(res);
+    }
+
+    // sinh(x) = h (2t - t^2 / (t + 1)) = h (t + t / (t + 1)) with
+    // t = expm1(|x|) and h = +-1/2 the sign of x
+    template<typename T>
+    constexpr auto sinh_from_expm1(T a, T h, T t)
+        -> T
+    {
+        if (a < 1) {
+            return h * (2 * t - t * t / (t + 1));
+        }
+        return h * (t + t / (t + 1));
+    }
+
+    // cosh(x) = 1 + t^2 / (2 (1 + t)) = (e + 1/e) / 2 with
+    // t = expm1(|x|) and e = t + 1
+    template<typename T>
+    constexpr auto cosh_from_expm1(T a, T t)
+        -> T
+    {
+        if (a < constants::ln2<T>) {
+            return 1 + t * t / (2 * (1 + t));
+        }
+        const T e = 1 + t;
+        return e / 2 + 1 / (2 * e);
+    }
+
+    template<typename Float>
+    constexpr auto sinh_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x) || x == 0) {
+            return x;
+        }
+        const work_type a = smath::abs(static_cast<work_type>(x));
+        const work_type h = x < 0 ? work_type(-0.5) : work_type(0.5);
+        if (a > hyper_saturation<Float>()) {
+            return hyper_large<Float>(a, h);
+        }
+        const work_type t = expm1_kernel<digits>(a);
+        return static_cast<Float>(sinh_from_expm1(a, h, t));
+    }
+
+    template<typename Float>
+    constexpr auto cosh_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        const work_type a = smath::abs(static_cast<work_type>(x));
+        if (a > hyper_saturation<Float>()) {
+            return hyper_large<Float>(a, work_type(0.5));
+        }
+        const work_type t = expm1_kernel<digits>(a);
+        return static_cast<Float>(cosh_from_expm1(a, t));
+    }
+
+    // Shares expm1(|x|) between both results, which are the same
+    // as the ones of sinh_helper and cosh_helper
+    template<typename Float>
+    constexpr auto sinhcosh_helper(Float x)
+        -> sinhcosh_t<Float>
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x)) {
+            return { x, x };
+        }
+        const work_type a = smath::abs(static_cast<work_type>(x));
+        const work_type h = x < 0 ? work_type(-0.5) : work_type(0.5);
+        if (a > hyper_saturation<Float>()) {
+            return { hyper_large<Float>(a, h), hyper_large<Float>(a, work_type(0.5)) };
+        }
+        const work_type t = expm1_kernel<digits>(a);
+        return {
+            x == 0 ? x : static_cast<Float>(sinh_from_expm1(a, h, t)),
+            static_cast<Float>(cosh_from_expm1(a, t))
+        };
+    }
+
+    // tanh(x) = 1 - 2 / (expm1(2|x|) + 2) = -expm1(-2|x|) / (expm1(-2|x|) + 2),
+    // the second form avoiding the cancellation for small |x|; a single
+    // expm1 is evaluated whatever the magnitude of x
+    template<typename Float>
+    constexpr auto tanh_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x) || x == 0) {
+            return x;
+        }
+        const work_type a = smath::abs(static_cast<work_type>(x));
+        work_type res = 1;
+        if (a <= hyper_saturation<Float>()) {
+            if (a > work_type(0.5493061443340548456976226184612628)) { // ln(3) / 2
+                const work_type t = expm1_kernel<digits>(2 * a);
+                res = 1 - 2 / (t + 2);
+            } else {
+                const work_type t = expm1_kernel<digits>(-2 * a);
+                res = -t / (t + 2);
+            }
+        }
+        return static_cast<Float>(x < 0 ? -res : res);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // sin & cos
+
+    // sin on [-pi/4, pi/4] for a type with the given precision
+    template<int Digits, typename T>
+    constexpr auto sin_kernel(T x)
+        -> T
+    {
+        const T z = x * x;
+        return x + x * z * detail::evaluate(z, sin_minimax<Digits>::coefficients());
+    }
+
+    // cos on [-pi/4, pi/4] for a type with the given precision
+    template<int Digits, typename T>
+    constexpr auto cos_kernel(T x)
+        -> T
+    {
+        const T z = x * x;
+        const T hz = z / 2;
+        const T w = 1 - hz;
+        // Recover the bits lost by 1 - hz
+        return w + (((1 - w) - hz) + z * z * detail::evaluate(z, cos_minimax<Digits>::coefficients()));
+    }
+
+    template<typename Float>
+    constexpr auto sin_helper(Float x)
+        -> Float
+    {
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (detail::is_nan(x) || detail::is_inf(x)) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        if (x == 0) {
+            // Preserve the sign of zero
+            return x;
+        }
+
+        const auto reduced = detail::rem_pio2(static_cast<reduction_t<Float>>(x));
+        switch (reduced.quadrant) {
+            case 0:  return static_cast<Float>(detail::sin_kernel<digits>(reduced.value));
+            case 1:  return static_cast<Float>(detail::cos_kernel<digits>(reduced.value));
+            case 2:  return static_cast<Float>(-detail::sin_kernel<digits>(reduced.value));
+            default: return static_cast<Float>(-detail::cos_kernel<digits>(reduced.value));
+        }
+    }
+
+    template<typename Float>
+    constexpr auto cos_helper(Float x)
+        -> Float
+    {
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (detail::is_nan(x) || detail::is_inf(x)) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+
+        const auto reduced = detail::rem_pio2(static_cast<reduction_t<Float>>(x));
+        switch (reduced.quadrant) {
+            case 0:  return static_cast<Float>(detail::cos_kernel<digits>(reduced.value));
+            case 1:  return static_cast<Float>(-detail::sin_kernel<digits>(reduced.value));
+            case 2:  return static_cast<Float>(-detail::cos_kernel<digits>(reduced.value));
+            default: return static_cast<Float>(detail::sin_kernel<digits>(reduced.value));
+        }
+    }
+
+    template<typename Float>
+    constexpr auto sincos_helper(Float x)
+        -> sincos_t<Float>
+    {
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (detail::is_nan(x) || detail::is_inf(x)) {
+            return {
+                std::numeric_limits<Float>::quiet_NaN(),
+                std::numeric_limits<Float>::quiet_NaN()
+            };
+        }
+        if (x == 0) {
+            return { x, Float(1) };
+        }
+
+        // Same kernels as sin and cos, so the results are identical
+        const auto reduced = detail::rem_pio2(static_cast<reduction_t<Float>>(x));
+        const auto s = static_cast<Float>(detail::sin_kernel<digits>(reduced.value));
+        const auto c = static_cast<Float>(detail::cos_kernel<digits>(reduced.value));
+        switch (reduced.quadrant) {
+            case 0:  return { s, c };
+            case 1:  return { c, -s };
+            case 2:  return { -s, -c };
+            default: return { -c, s };
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // asin & acos
+
+    // asin(x) - x on [-1/2, 1/2] for a type with the given precision
+    template<int Digits, typename T>
+    constexpr auto asin_tail(T x)
+        -> T
+    {
+        const T z = x * x;
+        return x * z * detail::evaluate(z, asin_minimax<Digits>::coefficients());
+    }
+
+    // For x in (1/2, 1], asin(x) = pi/2 - 2 asin(s) with s = sqrt((1 - x) / 2);
+    // returns s and the rounding error of s, 2 asin(s) being 2 (s + (c + asin_tail(s)))
+    template<typename T>
+    constexpr auto asin_half_angle(T x)
+        -> float_pair<T>
+    {
+        // Exact since x is in (1/2, 1]
+        const T z = (1 - x) / 2;
+        const T s = detail::sqrt_helper(z);
+        if (s == 0) {
+            return { s, T(0) };
+        }
+        const float_pair<T> sq = two_prod(s, s);
+        return { s, ((z - sq.hi) - sq.lo) / (2 * s) };
+    }
+
+    template<typename Float>
+    constexpr auto asin_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        using pio2 = pio2_split<std::numeric_limits<work_type>::digits>;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        const auto wx = static_cast<work_type>(x);
+        const work_type a = smath::abs(wx);
+        if (a > 1) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        if (a <= work_type(0.5)) {
+            return static_cast<Float>(wx + asin_tail<digits>(wx));
+        }
+
+        const float_pair<work_type> s = asin_half_angle(a);
+        const work_type tail = asin_tail<digits>(s.hi) + s.lo;
+        const work_type res = 2 * (pio2::hi / 2 - (s.hi + (tail - pio2::lo / 2)));
+        return static_cast<Float>(wx < 0 ? -res : res);
+    }
+
+    template<typename Float>
+    constexpr auto acos_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        using pio2 = pio2_split<std::numeric_limits<work_type>::digits>;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        const auto wx = static_cast<work_type>(x);
+        const work_type a = smath::abs(wx);
+        if (a > 1) {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+        if (a <= work_type(0.5)) {
+            // acos(x) = pi/2 - asin(x)
+            return static_cast<Float>(pio2::hi - (wx - (pio2::lo - asin_tail<digits>(wx))));
+        }
+
+        // acos(x) = 2 asin(s) and acos(-x) = pi - 2 asin(s)
+        const float_pair<work_type> s = asin_half_angle(a);
+        const work_type tail = asin_tail<digits>(s.hi) + s.lo;
+        if (wx > 0) {
+            return static_cast<Float>(2 * (s.hi + tail));
+        }
+        return static_cast<Float>(2 * (pio2::hi - (s.hi + (tail - pio2::lo))));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // atan & atan2
+
+    // atan of a non-negative x, reduced to [-7/16, 7/16] with
+    // atan(x) = atan(c) + atan((x - c) / (1 + cx)) for c in
+    // {1/2, 1, 3/2} and atan(x) = pi/2 - atan(1/x)
+    template<int Digits, typename T>
+    constexpr auto atan_positive(T x)
+        -> T
+    {
+        using split = atan_split<std::numeric_limits<T>::digits>;
+        using pio2 = pio2_split<std::numeric_limits<T>::digits>;
+
+        T base_hi = 0;
+        T base_lo = 0;
+        T t = x;
+        if (x >= T(39) / 16) {
+            t = -1 / x;
+            base_hi = pio2::hi;
+            base_lo = pio2::lo;
+        } else if (x >= T(19) / 16) {
+            t = (x - T(1.5)) / (1 + T(1.5) * x);
+            base_hi = split::three_halves_hi;
+            base_lo = split::three_halves_lo;
+        } else if (x >= T(11) / 16) {
+            t = (x - 1) / (x + 1);
+            base_hi = pio2::hi / 2;
+            base_lo = pio2::lo / 2;
+        } else if (x >= T(7) / 16) {
+            t = (2 * x - 1) / (2 + x);
+            base_hi = split::half_hi;
+            base_lo = split::half_lo;
+        }
+
+        const T z = t * t;
+        const T tail = t * z * detail::evaluate(z, atan_minimax<Digits>::coefficients());
+        return base_hi + ((tail + base_lo) + t);
+    }
+
+    template<typename Float>
+    constexpr auto atan_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x) || x == 0) {
+            // Preserve the sign of zero
+            return x;
+        }
+        const work_type res = atan_positive<digits>(smath::abs(static_cast<work_type>(x)));
+        return static_cast<Float>(x < 0 ? -res : res);
+    }
+
+    template<typename Float>
+    constexpr auto atan2_helper(Float y, Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        using pio2 = pio2_split<std::numeric_limits<work_type>::digits>;
+
+        if (is_nan(y) || is_nan(x)) {
+            return y + x;
+        }
+
+        // Angle for |y| and x, the sign of y is applied at the end
+        work_type res = 0;
+        if (y == 0) {
+            if (!detail::sign_bit(x)) {
+                return y;
+            }
+            res = 2 * pio2::hi + 2 * pio2::lo;
+        } else if (x == 0 || (is_inf(y) && !is_inf(x))) {
+            res = pio2::hi + pio2::lo;
+        } else if (is_inf(x)) {
+            if (is_inf(y)) {
+                res = x > 0 ? pio2::hi / 2 + pio2::lo / 2
+                            : 3 * (pio2::hi / 2) + 3 * (pio2::lo / 2);
+            } else {
+                res = x > 0 ? 0 : 2 * pio2::hi + 2 * pio2::lo;
+            }
+        } else {
+            const auto wy = static_cast<work_type>(y);
+            const auto wx = static_cast<work_type>(x);
+            const work_type a = atan_positive<digits>(smath::abs(wy / wx));
+            res = x > 0 ? a : 2 * pio2::hi - (a - 2 * pio2::lo);
+        }
+        return static_cast<Float>(detail::sign_bit(y) ? -res : res);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // erf & erfc
+
+    // exp(-x^2), x^2 being computed as an unevaluated sum so that
+    // its rounding error isn't magnified by exp
+    template<int Digits, typename T>
+    constexpr auto exp_minus_square(T x)
+        -> T
+    {
+        const float_pair<T> z = two_prod(x, x);
+        return exp_kernel<Digits>(-z.hi, -z.lo);
+    }
+
+    // erfc(x) for x >= 1/2 and a type with the given precision, as
+    // exp(-x^2) erfcx(x) where the scaled complementary error function
+    // erfcx is smooth enough to be approximated by polynomials; x must
+    // be small enough for exp(-x^2) not to underflow; the polynomials
+    // are the whole result instead of a small correction, so they are
+    // evaluated with the more accurate Horner scheme
+    template<int Digits, typename T>
+    constexpr auto erfc_kernel(T x)
+        -> T
+    {
+        T r = 0;
+        if (x < T(1.5)) {
+            r = horner(x - 1, erfcx_near_minimax<Digits>::coefficients());
+        } else if (x < 3) {
+            r = horner(x - T(2.25), erfcx_mid_minimax<Digits>::coefficients());
+        } else {
+            r = horner(1 / (x * x), erfcx_far_minimax<Digits>::coefficients()) / x;
+        }
+        return exp_minus_square<Digits>(x) * r;
+    }
+
+    template<typename Float>
+    constexpr auto erf_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        const auto a = static_cast<work_type>(x < 0 ? -x : x);
+        if (a < work_type(0.5)) {
+            // Also preserves the sign of zero
+            const auto wx = static_cast<work_type>(x);
+            return static_cast<Float>(wx + wx * evaluate(wx * wx, erf_minimax<digits>::coefficients()));
+        }
+
+        // erfc(x) < 2^-(digits+2) when exp(-x^2) is, erf(x) rounds to 1
+        work_type res = 1;
+        if (a * a < (digits + 2) * constants::ln2<work_type>) {
+            res = 1 - erfc_kernel<digits>(a);
+        }
+        return static_cast<Float>(x < 0 ? -res : res);
+    }
+
+    template<typename Float>
+    constexpr auto erfc_helper(Float x)
+        -> Float
+    {
+        using work_type = reduction_t<Float>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+
+        if (is_nan(x)) {
+            return x;
+        }
+        const auto wx = static_cast<work_type>(x);
+        if (wx < work_type(0.5) && wx > work_type(-0.5)) {
+            return static_cast<Float>(1 - (wx + wx * evaluate(wx * wx, erf_minimax<digits>::coefficients())));
+        }
+
+        // erfc(x) is lesser than exp(-x^2), which is lesser than half
+        // the smallest subnormal number of Float past that bound
+        constexpr int min_exponent = std::numeric_limits<Float>::min_exponent - digits - 1;
+        const work_type a = wx < 0 ? -wx : wx;
+        if (a * a > -min_exponent * constants::ln2<work_type>) {
+            return x < 0 ? Float(2) : Float(0);
+        }
+        const work_type res = erfc_kernel<digits>(a);
+        return static_cast<Float>(x < 0 ? 2 - res : res);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // tgamma & lgamma
+
+    // Q(e) = (gamma(1 + e) - 1) / (e (e - 1)) for e in [0, 1], which
+    // is approximated around 1/2 since its Taylor coefficients around
+    // 0 alternate and barely decrease; like in erfc_kernel, the Horner
+    // scheme is used for accuracy
+    template<int Digits, typename T>
+    constexpr auto gamma_ratio(T e)
+        -> T
+    {
+        return horner(e - T(0.5), gamma_minimax<Digits>::coefficients());
+    }
+
+    // gamma(1 + e) - 1 for e in [0, 1], with its zeros at 0 and 1
+    // factored out so that it is accurate close to both of them
+    template<int Digits, typename T>
+    constexpr auto gamma1p_minus_one(T e)
+        -> T
+    {
+        return e * (e - 1) * gamma_ratio<Digits>(e);
+    }
+
+    template<typename T>
+    constexpr auto mul_pair(float_pair<T> a, T b)
+        -> float_pair<T>
+    {
+        const float_pair<T> p = two_prod(a.hi, b);
+        return two_sum(p.hi, p.lo + a.lo * b);
+    }
+
+    // gamma(x) for a non-integer x with |x| < 12: the recurrence
+    // gamma(x + 1) = x gamma(x) brings x back to [1, 2] with factors
+    // that are all exact since they move x toward [0, 2], and their
+    // products are computed with twice the precision of the type
+    template<int Digits, typename T>
+    constexpr auto gamma_recurrence(T x)
+        -> T
+    {
+        float_pair<T> num = { T(1), T(0) };
+        float_pair<T> den = { T(1), T(0) };
+        T y = x;
+        while (y > 2) {
+            y -= 1;
+            num = mul_pair(num, y);
+        }
+        while (y < 0) {
+            den = mul_pair(den, y);
+            y += 1;
+        }
+        T e = y - 1;
+        if (y < 1) {
+            // gamma(y) = gamma(1 + y) / y, 1 + y isn't computed
+            den = mul_pair(den, y);
+            e = y;
         }
-    };
+        const T g = 1 + gamma1p_minus_one<Digits>(e);
+        return g * ((num.hi + num.lo) / (den.hi + den.lo));
+    }
 
-    template<std::size_t N, typename T>
-    constexpr auto sin_helper(T x)
-        -> T
+    // lgamma(x) for x >= 12 as an unevaluated sum, with the Stirling
+    // series (x - 1/2) log(x) - x + log(2 pi)/2 + P(1/x^2)/x written
+    // as x (log(x) - 1) - log(x)/2 + ... so that the first product
+    // only overflows when the result does; the caller must ensure
+    // that x (log(x) - 1) is finite
+    template<int Digits, typename T>
+    constexpr auto lgamma_stirling(T x, float_pair<T> log_x)
+        -> float_pair<T>
     {
-        return sine<N>::trig(x);
+        using split = half_log_2pi_split<std::numeric_limits<T>::digits>;
+
+        const float_pair<T> d = two_sum(log_x.hi, T(-1));
+        const float_pair<T> p = two_prod(x, d.hi);
+        const T tail = evaluate(1 / (x * x), lgamma_minimax<Digits>::coefficients()) / x;
+        const float_pair<T> c = two_sum(split::hi, -(log_x.hi / 2));
+        const float_pair<T> res = two_sum(p.hi, c.hi);
+        const T lo = res.lo + (p.lo + x * (d.lo + log_x.lo)) + (c.lo + (split::lo - log_x.lo / 2 + tail));
+        return two_sum(res.hi, lo);
     }
 
-    template<std::size_t N, typename T>
-    constexpr auto sinh_helper(T x)
+    // sin(pi x) for a finite x, with the sign of the integer closest
+    // to x folded into the result; x - round(x) is exact
+    template<typename T>
+    constexpr auto sinpi_helper(T x)
         -> T
     {
-        return sine<N>::hyper(x);
-    }
-
-    ////////////////////////////////////////////////////////////
-    // cos & cosh (contributed by theLOLflashlight)
+        using pio2 = pio2_split<std::numeric_limits<T>::digits>;
 
-    constexpr std::size_t cos_max_depth = 50;
-    static_assert(detail::is_even(cos_max_depth), "");
+        const T n = round_helper(x);
+        const T r = x - n;
+        const T res = sin_helper(2 * pio2::hi * r);
+        return is_integer_value(n / 2) ? res : -res;
+    }
 
-    template<std::size_t N>
-    struct cosine
+    template<typename Float>
+    constexpr auto tgamma_helper(Float x)
+        -> Float
     {
-        cosine() = delete;
-
-        static_assert(detail::is_even(N), "N must be even for cos functions");
-        static_assert(N < cos_max_depth, "exceeded maximum recursion depth");
-
-        template<typename T>
-        static constexpr auto trig(T x)
-            -> T
-        {
-            return trig_helper(x, N, is_even(N / 2)) + cosine<N + 2>::trig(x);
+        using work_type = reduction_t<Float>;
+        using pio2 = pio2_split<std::numeric_limits<work_type>::digits>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        constexpr Float infinity = std::numeric_limits<Float>::infinity();
+        constexpr int max_exponent = std::numeric_limits<Float>::max_exponent;
+        constexpr int min_exponent = std::numeric_limits<Float>::min_exponent - digits - 1;
+
+        if (is_nan(x) || x == infinity) {
+            return x;
         }
-
-        template<typename T>
-        static constexpr auto hyper(T x)
-            -> T
-        {
-            return xn_nfac(x, N) + cosine<N + 2>::hyper(x);
+        if (x == 0) {
+            return sign_bit(x) ? -infinity : infinity;
+        }
+        if (x < 0 && is_integer_value(x)) {
+            return std::numeric_limits<Float>::quiet_NaN();
         }
-    };
 
-    template<>
-    struct cosine<cos_max_depth>
-    {
-        cosine() = delete;
+        const auto wx = static_cast<work_type>(x);
+        const work_type a = wx < 0 ? -wx : wx;
+        if (a < 1 / std::numeric_limits<work_type>::max()) {
+            // gamma(x) is about 1/x
+            return wx < 0 ? -infinity : infinity;
+        }
+        // gamma(max_exponent) overflows for every floating point type
+        if (wx >= max_exponent) {
+            return infinity;
+        }
 
-        template<typename T>
-        static constexpr auto trig(T)
-            -> T
-        {
-            return T();
+        work_type res = 0;
+        if (a < 12) {
+            res = gamma_recurrence<digits>(wx);
+        } else {
+            // log(gamma(|x|)), and for negative x the reflection formula
+            // gamma(x) = -pi / (x sin(pi x) gamma(-x)) in logarithmic form
+            float_pair<work_type> l = lgamma_stirling<digits>(a, log_pair<digits>(a));
+            work_type sign = 1;
+            if (wx < 0) {
+                if (wx <= -max_exponent) {
+                    // The result underflows, gamma(x) is negative when
+                    // floor(x) is odd
+                    return is_integer_value(floor_helper(wx) / 2) ? Float(0) : -Float(0);
+                }
+                const work_type t = wx * sinpi_helper(wx);
+                sign = t < 0 ? 1 : -1;
+                const float_pair<work_type> lr = log_pair<digits>(2 * pio2::hi / (t < 0 ? -t : t));
+                const float_pair<work_type> d = two_sum(lr.hi, -l.hi);
+                l = two_sum(d.hi, d.lo + (lr.lo - l.lo));
+            }
+            if (l.hi > max_exponent * constants::ln2<work_type>) {
+                return sign < 0 ? -infinity : infinity;
+            }
+            if (l.hi < min_exponent * constants::ln2<work_type>) {
+                return sign < 0 ? -Float(0) : Float(0);
+            }
+            res = sign * exp_kernel<digits>(l.hi, l.lo);
         }
 
-        template<typename T>
-        static constexpr auto hyper(T)
-            -> T
-        {
-            return T();
+        if (res > std::numeric_limits<Float>::max()) {
+            return infinity;
         }
-    };
+        if (res < -std::numeric_limits<Float>::max()) {
+            return -infinity;
+        }
+        return static_cast<Float>(res);
+    }
 
-    template<std::size_t N, typename T>
-    constexpr auto cos_helper(T x)
+    // lgamma(x) for a positive x, as log(gamma(x)) close to [1, 3] where
+    // gamma(x) - 1 is computed directly to avoid the cancellations
+    // around the zeros of lgamma at 1 and 2, and with the Stirling
+    // series for large x
+    template<int Digits, typename T>
+    constexpr auto lgamma_positive(T x)
         -> T
     {
-        return cosine<N>::trig(x);
+        if (x >= pow2<T>(std::numeric_limits<T>::digits)) {
+            // The other terms of the Stirling series are negligible,
+            // and the products of lgamma_stirling could overflow
+            return x * (logf_helper(x) - 1);
+        }
+        if (x >= 12) {
+            const float_pair<T> l = log_pair<Digits>(x);
+            const float_pair<T> res = lgamma_stirling<Digits>(x, l);
+            return res.hi + res.lo;
+        }
+        if (x > 3) {
+            return logf_helper(gamma_recurrence<Digits>(x));
+        }
+        if (x > 2) {
+            // gamma(x) - 1 = e (1 + (e^2 - 1) Q(e)) with e = x - 2
+            const T e = x - 2;
+            const T q = gamma_ratio<Digits>(e);
+            return log1p_helper(e * (1 + (e - 1) * (e + 1) * q));
+        }
+        if (x >= 1) {
+            return log1p_helper(gamma1p_minus_one<Digits>(x - 1));
+        }
+        if (x >= T(0.5)) {
+            // gamma(x) - 1 = (1 - x) (1 - x Q(x)) / x
+            const T q = gamma_ratio<Digits>(x);
+            return log1p_helper((1 - x) * (1 - x * q) / x);
+        }
+        // lgamma(x) = lgamma(1 + x) - log(x), 1 + x isn't computed
+        return log1p_helper(gamma1p_minus_one<Digits>(x)) - logf_helper(x);
     }
 
-    template<std::size_t N, typename T>
-    constexpr auto cosh_helper(T x)
-        -> T
+    template<typename Float>
+    constexpr auto lgamma_helper(Float x)
+        -> Float
     {
-        return cosine<N>::hyper(x);
+        using work_type = reduction_t<Float>;
+        using pio2 = pio2_split<std::numeric_limits<work_type>::digits>;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        constexpr Float infinity = std::numeric_limits<Float>::infinity();
+
+        if (is_nan(x)) {
+            return x;
+        }
+        if (is_inf(x) || (x <= 0 && is_integer_value(x))) {
+            return infinity;
+        }
+        // The kernel can round to -0 at the exact zeros, which are +0
+        // in C Annex F
+        if (x == 1 || x == 2) {
+            return Float(0);
+        }
+
+        const auto wx = static_cast<work_type>(x);
+        const work_type a = wx < 0 ? -wx : wx;
+        // x (log(x) - 1) overflows, and so does the result
+        if (a >= 12) {
+            constexpr work_type max = std::numeric_limits<work_type>::max();
+            if (a >= max / (logf_helper(a) - 1)) {
+                return infinity;
+            }
+        }
+
+        work_type res = lgamma_positive<digits>(a);
+        if (wx < 0) {
+            // Reflection formula: lgamma(x) = log(pi / |x sin(pi x)|) - lgamma(-x)
+            const work_type t = smath::abs(wx * sinpi_helper(wx));
+            res = logf_helper(2 * pio2::hi / t) - res;
+        }
+        if (res > std::numeric_limits<Float>::max()) {
+            return infinity;
+        }
+        return static_cast<Float>(res);
     }
 }
 
@@ -561,46 +1993,252 @@ template<typename Float>
 constexpr auto floor(Float x)
     -> decltype(std::floor(x))
 {
-    return (int(x) == x) ? int(x) :
-        (x >= 0.0) ? int(x) :
-            int(x) - 1;
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::floor(x);
+    }
+#endif
+    using float_type = decltype(std::floor(x));
+    return detail::floor_helper(static_cast<float_type>(x));
 }
 
 template<typename Float>
 constexpr auto ceil(Float x)
     -> decltype(std::ceil(x))
 {
-    return (int(x) == x) ? int(x) :
-        (x >= 0.0) ? int(x) + 1 :
-            int(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::ceil(x);
+    }
+#endif
+    using float_type = decltype(std::ceil(x));
+    return detail::ceil_helper(static_cast<float_type>(x));
 }
 
 template<typename Float>
 constexpr auto round(Float x)
     -> decltype(std::round(x))
 {
-    return (x >= 0.0) ? int(x + 0.5) : int(x - 0.5);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::round(x);
+    }
+#endif
+    using float_type = decltype(std::round(x));
+    return detail::round_helper(static_cast<float_type>(x));
 }
 
 template<typename Float>
 constexpr auto lround(Float x)
     -> decltype(std::lround(x))
 {
-    return (x >= 0.0) ? long(x + 0.5) : long(x - 0.5);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::lround(x);
+    }
+#endif
+    using float_type = decltype(std::round(x));
+    return static_cast<long>(detail::round_helper(static_cast<float_type>(x)));
 }
 
 template<typename Float>
 constexpr auto llround(Float x)
     -> decltype(std::llround(x))
 {
-    return (x >= 0.0) ? (long long)(x + 0.5) : (long long)(x - 0.5);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::llround(x);
+    }
+#endif
+    using float_type = decltype(std::round(x));
+    return static_cast<long long>(detail::round_helper(static_cast<float_type>(x)));
 }
 
 template<typename Float>
 constexpr auto trunc(Float x)
     -> decltype(std::trunc(x))
 {
-    return int(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::trunc(x);
+    }
+#endif
+    using float_type = decltype(std::trunc(x));
+    return detail::trunc_helper(static_cast<float_type>(x));
+}
+
+template<typename Number1, typename Number2>
+constexpr auto fmod(Number1 x, Number2 y)
+    -> decltype(std::fmod(x, y))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::fmod(x, y);
+    }
+#endif
+    using float_type = decltype(std::fmod(x, y));
+    return detail::fmod_helper(static_cast<float_type>(x), static_cast<float_type>(y));
+}
+
+template<typename Number1, typename Number2>
+constexpr auto remainder(Number1 x, Number2 y)
+    -> decltype(std::remainder(x, y))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::remainder(x, y);
+    }
+#endif
+    using float_type = decltype(std::remainder(x, y));
+    int quo = 0;
+    return detail::remquo_helper(static_cast<float_type>(x), static_cast<float_type>(y), &quo);
+}
+
+template<typename Number1, typename Number2>
+constexpr auto remquo(Number1 x, Number2 y, int* quo)
+    -> decltype(std::remquo(x, y, quo))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::remquo(x, y, quo);
+    }
+#endif
+    using float_type = decltype(std::remquo(x, y, quo));
+    return detail::remquo_helper(static_cast<float_type>(x), static_cast<float_type>(y), quo);
+}
+
+////////////////////////////////////////////////////////////
+// Floating point manipulation functions
+
+template<typename Float>
+constexpr auto frexp(Float x, int* exp)
+    -> decltype(std::frexp(x, exp))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::frexp(x, exp);
+    }
+#endif
+    using float_type = decltype(std::frexp(x, exp));
+    return detail::frexp_helper(static_cast<float_type>(x), exp);
+}
+
+template<typename Float>
+constexpr auto ldexp(Float x, int exp)
+    -> decltype(std::ldexp(x, exp))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::ldexp(x, exp);
+    }
+#endif
+    using float_type = decltype(std::ldexp(x, exp));
+    return detail::ldexp_helper(static_cast<float_type>(x), exp);
+}
+
+template<typename Float>
+constexpr auto scalbn(Float x, int exp)
+    -> decltype(std::scalbn(x, exp))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::scalbn(x, exp);
+    }
+#endif
+    // FLT_RADIX is 2 for every supported type
+    using float_type = decltype(std::scalbn(x, exp));
+    return detail::ldexp_helper(static_cast<float_type>(x), exp);
+}
+
+template<typename Float>
+constexpr auto ilogb(Float x)
+    -> int
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::ilogb(x);
+    }
+#endif
+    using float_type = decltype(std::logb(x));
+    const auto fx = static_cast<float_type>(x);
+    if (fx == 0) {
+        return FP_ILOGB0;
+    }
+    if (detail::is_nan(fx)) {
+        return FP_ILOGBNAN;
+    }
+    if (detail::is_inf(fx)) {
+        return std::numeric_limits<int>::max();
+    }
+    int exp = 0;
+    detail::frexp_helper(fx, &exp);
+    return exp - 1;
+}
+
+template<typename Float>
+constexpr auto logb(Float x)
+    -> decltype(std::logb(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::logb(x);
+    }
+#endif
+    using float_type = decltype(std::logb(x));
+    const auto fx = static_cast<float_type>(x);
+    if (fx == 0) {
+        return -std::numeric_limits<float_type>::infinity();
+    }
+    if (detail::is_nan(fx)) {
+        return fx;
+    }
+    if (detail::is_inf(fx)) {
+        return std::numeric_limits<float_type>::infinity();
+    }
+    int exp = 0;
+    detail::frexp_helper(fx, &exp);
+    return static_cast<float_type>(exp - 1);
+}
+
+template<typename Number1, typename Number2>
+constexpr auto nextafter(Number1 from, Number2 to)
+    -> decltype(std::nextafter(from, to))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::nextafter(from, to);
+    }
+#endif
+    using float_type = decltype(std::nextafter(from, to));
+    return detail::nextafter_helper(static_cast<float_type>(from), static_cast<float_type>(to));
+}
+
+template<typename Number1, typename Number2>
+constexpr auto copysign(Number1 x, Number2 y)
+    -> decltype(std::copysign(x, y))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::copysign(x, y);
+    }
+#endif
+    using float_type = decltype(std::copysign(x, y));
+    const auto fx = static_cast<float_type>(x);
+    const auto fy = static_cast<float_type>(y);
+    return (detail::sign_bit(fx) != detail::sign_bit(fy)) ? -fx : fx;
+}
+
+template<typename Float>
+constexpr auto signbit(Float x)
+    -> bool
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::signbit(x);
+    }
+#endif
+    using float_type = decltype(std::logb(x));
+    return detail::sign_bit(static_cast<float_type>(x));
 }
 
 ////////////////////////////////////////////////////////////
@@ -610,23 +2248,95 @@ template<typename Float>
 constexpr auto exp(Float x)
     -> decltype(std::exp(x))
 {
-    return (x < 0.0) ?
-        1.0 / smath::exp(-x) :
-        1 + x + detail::exp_helper<2>(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::exp(x);
+    }
+#endif
+    using float_type = decltype(std::exp(x));
+    return detail::exp_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto exp2(Float x)
+    -> decltype(std::exp2(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::exp2(x);
+    }
+#endif
+    using float_type = decltype(std::exp2(x));
+    return detail::exp2_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto exp10(Float x)
+    -> decltype(std::exp(x))
+{
+    using float_type = decltype(std::exp(x));
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::pow(float_type(10), static_cast<float_type>(x));
+    }
+#endif
+    return detail::exp10_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto expm1(Float x)
+    -> decltype(std::expm1(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::expm1(x);
+    }
+#endif
+    using float_type = decltype(std::expm1(x));
+    return detail::expm1_helper(static_cast<float_type>(x));
 }
 
 template<typename Number, typename Integer>
 constexpr auto pow(Number x, Integer exponent)
-    -> std::common_type_t<Number, Integer>
+    -> std::enable_if_t<
+        std::is_integral<Integer>::value,
+        std::common_type_t<Number, Integer>
+    >
 {
-    static_assert(std::is_integral<Integer>::value,
-                  "pow only accepts integer exponents");
-
     return (exponent == 0) ? 1 :
         (exponent > 0) ? detail::pow_helper(x, exponent) :
             1 / detail::pow_helper(x, -exponent);
 }
 
+template<typename Number, typename Float>
+constexpr auto pow(Number x, Float exponent)
+    -> std::enable_if_t<
+        std::is_floating_point<Float>::value,
+        decltype(std::pow(x, exponent))
+    >
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::pow(x, exponent);
+    }
+#endif
+    using float_type = decltype(std::pow(x, exponent));
+    return detail::pow_real_helper(static_cast<float_type>(x), static_cast<float_type>(exponent));
+}
+
+template<typename Float>
+constexpr auto cbrt(Float x)
+    -> decltype(std::cbrt(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::cbrt(x);
+    }
+#endif
+    using float_type = decltype(std::cbrt(x));
+    return detail::cbrt_helper(static_cast<float_type>(x));
+}
+
 #ifndef STATIC_MATH_NO_INTEGRAL_CONSTANT
 template<typename Integer, Integer N, Integer M>
 constexpr auto pow(constant<Integer, N>, constant<Integer, M>)
@@ -640,13 +2350,24 @@ template<typename Float>
 constexpr auto sqrt(Float x)
     -> decltype(std::sqrt(x))
 {
-    return detail::sqrt_helper(x, x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::sqrt(x);
+    }
+#endif
+    using float_type = decltype(std::sqrt(x));
+    return detail::sqrt_helper(static_cast<float_type>(x));
 }
 
 template<typename... Args>
 constexpr auto hypot(Args... args)
     -> decltype(auto)
 {
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return detail::hypot_kernel(detail::hypot_runtime_ops{}, args...);
+    }
+#endif
     return detail::hypot_helper(args...);
 }
 
@@ -654,7 +2375,26 @@ template<typename Float>
 constexpr auto log(Float x)
     -> decltype(std::log(x))
 {
-    return detail::logf_helper(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::log(x);
+    }
+#endif
+    using float_type = decltype(std::log(x));
+    return detail::logf_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto log1p(Float x)
+    -> decltype(std::log1p(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::log1p(x);
+    }
+#endif
+    using float_type = decltype(std::log1p(x));
+    return detail::log1p_helper(static_cast<float_type>(x));
 }
 
 template<typename Float>
@@ -678,21 +2418,106 @@ template<typename Float>
 constexpr auto sin(Float x)
     -> Float
 {
-    return x + detail::sin_helper<3>(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::sin(x);
+    }
+#endif
+    using float_type = decltype(std::sin(x));
+    return static_cast<Float>(detail::sin_helper(static_cast<float_type>(x)));
 }
 
 template<typename Float>
 constexpr auto cos(Float x)
     -> Float
 {
-    return 1 + detail::cos_helper<2>(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::cos(x);
+    }
+#endif
+    using float_type = decltype(std::cos(x));
+    return static_cast<Float>(detail::cos_helper(static_cast<float_type>(x)));
 }
 
 template<typename Float>
 constexpr auto tan(Float x)
     -> Float
 {
-    return sin(x) / cos(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::tan(x);
+    }
+#endif
+    using float_type = decltype(std::tan(x));
+    const auto res = detail::sincos_helper(static_cast<float_type>(x));
+    return static_cast<Float>(res.sin / res.cos);
+}
+
+template<typename Float>
+constexpr auto sincos(Float x)
+    -> sincos_t<decltype(std::sin(x))>
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        // Compilers merge both calls into a single one when possible
+        return { std::sin(x), std::cos(x) };
+    }
+#endif
+    using float_type = decltype(std::sin(x));
+    return detail::sincos_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto asin(Float x)
+    -> decltype(std::asin(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::asin(x);
+    }
+#endif
+    using float_type = decltype(std::asin(x));
+    return detail::asin_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto acos(Float x)
+    -> decltype(std::acos(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::acos(x);
+    }
+#endif
+    using float_type = decltype(std::acos(x));
+    return detail::acos_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto atan(Float x)
+    -> decltype(std::atan(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::atan(x);
+    }
+#endif
+    using float_type = decltype(std::atan(x));
+    return detail::atan_helper(static_cast<float_type>(x));
+}
+
+template<typename Number1, typename Number2>
+constexpr auto atan2(Number1 y, Number2 x)
+    -> decltype(std::atan2(y, x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::atan2(y, x);
+    }
+#endif
+    using float_type = decltype(std::atan2(y, x));
+    return detail::atan2_helper(static_cast<float_type>(y), static_cast<float_type>(x));
 }
 
 ////////////////////////////////////////////////////////////
@@ -702,19 +2527,105 @@ template<typename Float>
 constexpr auto sinh(Float x)
     -> Float
 {
-    return x + detail::sinh_helper<3>(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::sinh(x);
+    }
+#endif
+    using float_type = decltype(std::sinh(x));
+    return static_cast<Float>(detail::sinh_helper(static_cast<float_type>(x)));
 }
 
 template<typename Float>
 constexpr auto cosh(Float x)
     -> Float
 {
-    return 1 + detail::cosh_helper<2>(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::cosh(x);
+    }
+#endif
+    using float_type = decltype(std::cosh(x));
+    return static_cast<Float>(detail::cosh_helper(static_cast<float_type>(x)));
 }
 
 template<typename Float>
 constexpr auto tanh(Float x)
     -> Float
 {
-    return sinh(x) / cosh(x);
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::tanh(x);
+    }
+#endif
+    using float_type = decltype(std::tanh(x));
+    return static_cast<Float>(detail::tanh_helper(static_cast<float_type>(x)));
+}
+
+template<typename Float>
+constexpr auto sinhcosh(Float x)
+    -> sinhcosh_t<decltype(std::sinh(x))>
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return { std::sinh(x), std::cosh(x) };
+    }
+#endif
+    using float_type = decltype(std::sinh(x));
+    return detail::sinhcosh_helper(static_cast<float_type>(x));
+}
+
+////////////////////////////////////////////////////////////
+// Error and gamma functions
+
+template<typename Float>
+constexpr auto erf(Float x)
+    -> decltype(std::erf(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::erf(x);
+    }
+#endif
+    using float_type = decltype(std::erf(x));
+    return detail::erf_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto erfc(Float x)
+    -> decltype(std::erfc(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::erfc(x);
+    }
+#endif
+    using float_type = decltype(std::erfc(x));
+    return detail::erfc_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto tgamma(Float x)
+    -> decltype(std::tgamma(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::tgamma(x);
+    }
+#endif
+    using float_type = decltype(std::tgamma(x));
+    return detail::tgamma_helper(static_cast<float_type>(x));
+}
+
+template<typename Float>
+constexpr auto lgamma(Float x)
+    -> decltype(std::lgamma(x))
+{
+#ifdef STATIC_MATH_RUNTIME_DISPATCH
+    if (!detail::is_constant_evaluated()) {
+        return std::lgamma(x);
+    }
+#endif
+    using float_type = decltype(std::lgamma(x));
+    return detail::lgamma_helper(static_cast<float_type>(x));
 }
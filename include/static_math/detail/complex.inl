@@ -645,6 +645,13 @@ constexpr auto abs(complex<T> z)
     return smath::hypot(z.real, z.imag.value);
 }
 
+template<typename T>
+constexpr auto arg(complex<T> z)
+    -> T
+{
+    return smath::atan2(z.imag.value, z.real);
+}
+
 template<typename T>
 constexpr auto norm(complex<T> z)
     -> T
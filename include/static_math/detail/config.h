@@ -0,0 +1,154 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_DETAIL_CONFIG_H_
+#define SMATH_DETAIL_CONFIG_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#if defined(__has_include)
+#   if __has_include(<version>)
+#       include <version>
+#   endif
+#endif
+#include <type_traits>
+
+// Runtime dispatch: when it is enabled, the mathematical functions
+// forward to the standard library when they are called at runtime
+// and only use their constexpr implementation at compile time. It
+// is enabled by default when std::is_constant_evaluated is available
+// and can be enabled with the macro STATIC_MATH_RUNTIME_DISPATCH when
+// the compiler provides __builtin_is_constant_evaluated in C++14/17.
+// STATIC_MATH_NO_RUNTIME_DISPATCH always disables it.
+
+#if defined(__has_builtin)
+#   if __has_builtin(__builtin_is_constant_evaluated)
+#       define STATIC_MATH_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#   endif
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+#   define STATIC_MATH_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#   define STATIC_MATH_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#endif
+
+#ifdef STATIC_MATH_NO_RUNTIME_DISPATCH
+#   undef STATIC_MATH_RUNTIME_DISPATCH
+#elif defined(__cpp_lib_is_constant_evaluated)
+#   ifndef STATIC_MATH_RUNTIME_DISPATCH
+#       define STATIC_MATH_RUNTIME_DISPATCH
+#   endif
+#elif defined(STATIC_MATH_RUNTIME_DISPATCH)
+#   ifndef STATIC_MATH_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+#       error "STATIC_MATH_RUNTIME_DISPATCH requires std::is_constant_evaluated or __builtin_is_constant_evaluated"
+#   endif
+#endif
+
+// Bit casts: when available, they are used to access the bits of
+// float and double directly instead of relying on arithmetic
+
+#if defined(__cpp_lib_bit_cast)
+#   include <bit>
+#   define STATIC_MATH_HAS_BIT_CAST
+#elif defined(__has_builtin)
+#   if __has_builtin(__builtin_bit_cast)
+#       define STATIC_MATH_HAS_BUILTIN_BIT_CAST
+#       define STATIC_MATH_HAS_BIT_CAST
+#   endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1927
+#   define STATIC_MATH_HAS_BUILTIN_BIT_CAST
+#   define STATIC_MATH_HAS_BIT_CAST
+#endif
+
+// Count of trailing zeros: GCC and Clang provide builtins which
+// map to a single instruction on most architectures and which are
+// usable in constant expressions; a portable loop is used otherwise
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define STATIC_MATH_HAS_BUILTIN_CTZ
+#endif
+
+// Overflow-checked integer arithmetic: GCC and Clang provide
+// builtins which report whether an addition, a subtraction or a
+// multiplication overflowed and which are usable in constant
+// expressions; a portable implementation is used otherwise
+
+#if defined(__has_builtin)
+#   if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) \
+      && __has_builtin(__builtin_mul_overflow)
+#       define STATIC_MATH_HAS_BUILTIN_OVERFLOW
+#   endif
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 7
+#   define STATIC_MATH_HAS_BUILTIN_OVERFLOW
+#endif
+
+// SIMD batch functions: the functions in static_math/batch.h use
+// vector instructions selected at runtime (SSE2, AVX2 or AVX-512)
+// when the compiler supports GCC's vector extensions and target
+// pragmas on x86, and fall back to a scalar loop otherwise. The
+// macro STATIC_MATH_NO_BATCH_SIMD disables the vector code paths.
+
+#if !defined(STATIC_MATH_NO_BATCH_SIMD) && defined(__GNUC__) && !defined(__clang__) \
+    && __GNUC__ >= 9 && (defined(__x86_64__) || defined(__i386__))
+#   define STATIC_MATH_HAS_BATCH_SIMD
+#endif
+
+namespace smath
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Whether we are in a constant-evaluated context
+
+    constexpr auto is_constant_evaluated() noexcept
+        -> bool
+    {
+#if defined(__cpp_lib_is_constant_evaluated)
+        return std::is_constant_evaluated();
+#elif defined(STATIC_MATH_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+        return __builtin_is_constant_evaluated();
+#else
+        // No way to know, assume compile time
+        return true;
+#endif
+    }
+
+#ifdef STATIC_MATH_HAS_BIT_CAST
+    ////////////////////////////////////////////////////////////
+    // Bit cast
+
+    template<typename To, typename From>
+    constexpr auto bit_cast(const From& from) noexcept
+        -> To
+    {
+        static_assert(sizeof(To) == sizeof(From), "bit_cast requires types of the same size");
+#   ifdef STATIC_MATH_HAS_BUILTIN_BIT_CAST
+        return __builtin_bit_cast(To, from);
+#   else
+        return std::bit_cast<To>(from);
+#   endif
+    }
+#endif
+}}
+
+#endif // SMATH_DETAIL_CONFIG_H_
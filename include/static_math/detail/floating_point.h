@@ -0,0 +1,422 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_DETAIL_FLOATING_POINT_H_
+#define SMATH_DETAIL_FLOATING_POINT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "config.h"
+
+// This header contains constexpr helpers to inspect and
+// manipulate the representation of floating point numbers:
+// they are the building blocks of the range reductions used
+// by the mathematical functions
+
+namespace smath
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Classification
+
+    template<typename T>
+    constexpr auto is_nan(T x)
+        -> bool
+    {
+        return x != x;
+    }
+
+    template<typename T>
+    constexpr auto is_inf(T x)
+        -> bool
+    {
+        return x == std::numeric_limits<T>::infinity()
+            || x == -std::numeric_limits<T>::infinity();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Bit representation
+
+    // Unsigned integer type with the same size as an IEEE 754
+    // binary floating point type, void if there is none
+    template<typename T>
+    using ieee754_bits_t = std::conditional_t<
+        std::numeric_limits<T>::is_iec559 && sizeof(T) == sizeof(std::uint32_t)
+            && std::numeric_limits<T>::digits == 24,
+        std::uint32_t,
+        std::conditional_t<
+            std::numeric_limits<T>::is_iec559 && sizeof(T) == sizeof(std::uint64_t)
+                && std::numeric_limits<T>::digits == 53,
+            std::uint64_t,
+            void
+        >
+    >;
+
+    // Whether the bits of T can be accessed directly
+    template<typename T>
+    using has_bit_representation = std::integral_constant<
+        bool,
+#ifdef STATIC_MATH_HAS_BIT_CAST
+        !std::is_void<ieee754_bits_t<T>>::value
+#else
+        false
+#endif
+    >;
+
+    ////////////////////////////////////////////////////////////
+    // Sign bit
+
+    // Unlike x < 0, also true for negative zeros; without access
+    // to the bits of x, a negative zero can only be detected with
+    // a compiler builtin
+    template<typename T>
+    constexpr auto sign_bit(std::false_type, T x)
+        -> bool
+    {
+#if defined(__GNUC__) && !defined(__clang__)
+        return __builtin_signbit(x);
+#else
+        return x < 0;
+#endif
+    }
+
+#ifdef STATIC_MATH_HAS_BIT_CAST
+    template<typename T>
+    constexpr auto sign_bit(std::true_type, T x)
+        -> bool
+    {
+        using bits_type = ieee754_bits_t<T>;
+        constexpr int sign_shift = std::numeric_limits<bits_type>::digits - 1;
+        return (detail::bit_cast<bits_type>(x) >> sign_shift) != 0;
+    }
+#endif
+
+    template<typename T>
+    constexpr auto sign_bit(T x)
+        -> bool
+    {
+        return sign_bit(has_bit_representation<T>{}, x);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Exact power of 2
+
+    template<typename T>
+    constexpr auto pow2(std::false_type, int n)
+        -> T
+    {
+        T res = 1;
+        T base = (n < 0) ? T(0.5) : T(2);
+        unsigned m = (n < 0) ? -n : n;
+        while (m != 0) {
+            if (m & 1u) {
+                res *= base;
+            }
+            m >>= 1;
+            if (m != 0) {
+                base *= base;
+            }
+        }
+        return res;
+    }
+
+#ifdef STATIC_MATH_HAS_BIT_CAST
+    template<typename T>
+    constexpr auto pow2(std::true_type, int n)
+        -> T
+    {
+        using bits_type = ieee754_bits_t<T>;
+        constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+        constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+        return detail::bit_cast<T>(static_cast<bits_type>(n + bias) << mantissa_bits);
+    }
+#endif
+
+    // Only valid when 2^n is a normal number of type T
+    template<typename T>
+    constexpr auto pow2(int n)
+        -> T
+    {
+        return pow2<T>(has_bit_representation<T>{}, n);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // frexp
+
+    // Splits a finite non-zero x into a mantissa in [0.5, 1) and
+    // a power of 2 by scaling it with decreasing powers of 2, so
+    // that the number of steps only depends on the type of x; this
+    // is used when the bits of x can't be accessed directly
+    template<typename T>
+    constexpr auto frexp_helper(std::false_type, T x, int* exp)
+        -> T
+    {
+        *exp = 0;
+        if (x == 0 || is_nan(x) || is_inf(x)) {
+            return x;
+        }
+
+        // powers[i] == 2^(2^i), the greatest one being the
+        // greatest 2^(2^i) lesser than the maximal exponent
+        constexpr int max_exponent = std::numeric_limits<T>::max_exponent;
+        T powers[16] = {};
+        int levels = 0;
+        powers[0] = 2;
+        while ((2 << levels) < max_exponent) {
+            powers[levels + 1] = powers[levels] * powers[levels];
+            ++levels;
+        }
+        ++levels;
+
+        T res = (x < 0) ? -x : x;
+        int e = 0;
+        for (int i = levels - 1 ; i >= 0 ; --i) {
+            while (res >= powers[i]) {
+                res /= powers[i];
+                e += 1 << i;
+            }
+        }
+        for (int i = levels - 1 ; i >= 0 ; --i) {
+            while (res * powers[i] < 2) {
+                res *= powers[i];
+                e -= 1 << i;
+            }
+        }
+
+        // res is in [1, 2) at this point
+        *exp = e + 1;
+        return (x < 0) ? -res / 2 : res / 2;
+    }
+
+#ifdef STATIC_MATH_HAS_BIT_CAST
+    // Directly reads and replaces the exponent bits
+    template<typename T>
+    constexpr auto frexp_helper(std::true_type, T x, int* exp)
+        -> T
+    {
+        using bits_type = ieee754_bits_t<T>;
+        constexpr int digits = std::numeric_limits<T>::digits;
+        constexpr int mantissa_bits = digits - 1;
+        constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+        constexpr bits_type exponent_mask = static_cast<bits_type>(2 * bias + 1) << mantissa_bits;
+
+        *exp = 0;
+        if (x == 0 || is_nan(x) || is_inf(x)) {
+            return x;
+        }
+
+        int offset = 0;
+        auto bits = detail::bit_cast<bits_type>(x);
+        if ((bits & exponent_mask) == 0) {
+            // Make subnormal numbers normal
+            bits = detail::bit_cast<bits_type>(x * pow2<T>(std::true_type{}, digits));
+            offset = digits;
+        }
+
+        *exp = static_cast<int>((bits & exponent_mask) >> mantissa_bits) - (bias - 1) - offset;
+        bits = (bits & ~exponent_mask) | (static_cast<bits_type>(bias - 1) << mantissa_bits);
+        return detail::bit_cast<T>(bits);
+    }
+#endif
+
+    template<typename T>
+    constexpr auto frexp_helper(T x, int* exp)
+        -> T
+    {
+        return frexp_helper(has_bit_representation<T>{}, x, exp);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // ldexp
+
+    template<typename T>
+    constexpr auto ldexp_helper(T x, int exp)
+        -> T
+    {
+        if (x == 0 || is_nan(x) || is_inf(x)) {
+            return x;
+        }
+
+        constexpr int max_exponent = std::numeric_limits<T>::max_exponent;
+        constexpr int min_exponent = std::numeric_limits<T>::min_exponent;
+        constexpr int digits = std::numeric_limits<T>::digits;
+
+        // Explicitly handle overflow and underflow, which would
+        // otherwise not be allowed in constant expressions; exp is
+        // compared to bounded values so that no subtraction
+        // overflows when it is close to INT_MIN or INT_MAX
+        int x_exp = 0;
+        frexp_helper(x, &x_exp);
+        if (exp > max_exponent - x_exp) {
+            return (x < 0) ? -std::numeric_limits<T>::infinity()
+                           : std::numeric_limits<T>::infinity();
+        }
+        if (exp < min_exponent - digits - x_exp) {
+            return (x < 0) ? -T(0) : T(0);
+        }
+
+        // Scale by steps that keep x normal so that only the
+        // last multiplication can round, even when the result
+        // is subnormal
+        while (exp > max_exponent - 1) {
+            x *= pow2<T>(max_exponent - 1);
+            exp -= max_exponent - 1;
+        }
+        while (exp < min_exponent - 1) {
+            x *= pow2<T>(min_exponent - 1 + digits);
+            exp -= min_exponent - 1 + digits;
+        }
+        return x * pow2<T>(exp);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // nextafter
+
+    // Adds or subtracts the spacing of the floating point numbers
+    // around from, which is halved below powers of 2 and constant
+    // among subnormal numbers; from must be non-zero and not NaN
+    template<typename T>
+    constexpr auto nextafter_helper(std::false_type, T from, T to)
+        -> T
+    {
+        constexpr int digits = std::numeric_limits<T>::digits;
+        constexpr int min_exponent = std::numeric_limits<T>::min_exponent;
+        constexpr T max = std::numeric_limits<T>::max();
+        constexpr T infinity = std::numeric_limits<T>::infinity();
+
+        if (is_inf(from)) {
+            return (from > 0) ? max : -max;
+        }
+
+        const bool up = to > from;
+        const bool away_from_zero = (from > 0) == up;
+        const T a = (from < 0) ? -from : from;
+        if (away_from_zero && a == max) {
+            return (from > 0) ? infinity : -infinity;
+        }
+
+        int e = 0;
+        const T m = frexp_helper(a, &e);
+        int ulp_exponent = ((e > min_exponent) ? e : min_exponent) - digits;
+        if (!away_from_zero && m == T(0.5) && e > min_exponent) {
+            --ulp_exponent;
+        }
+        // The spacing of subnormal numbers isn't a normal number
+        const T ulp = (ulp_exponent >= min_exponent - 1)
+            ? pow2<T>(ulp_exponent)
+            : pow2<T>(ulp_exponent + digits) * pow2<T>(-digits);
+        return up ? from + ulp : from - ulp;
+    }
+
+#ifdef STATIC_MATH_HAS_BIT_CAST
+    // Consecutive floating point numbers of the same sign have
+    // consecutive bit representations
+    template<typename T>
+    constexpr auto nextafter_helper(std::true_type, T from, T to)
+        -> T
+    {
+        using bits_type = ieee754_bits_t<T>;
+
+        auto bits = detail::bit_cast<bits_type>(from);
+        if ((from > 0) == (to > from)) {
+            ++bits;
+        } else {
+            --bits;
+        }
+        return detail::bit_cast<T>(bits);
+    }
+#endif
+
+    template<typename T>
+    constexpr auto nextafter_helper(T from, T to)
+        -> T
+    {
+        if (is_nan(from) || is_nan(to)) {
+            return from + to;
+        }
+        if (from == to) {
+            return to;
+        }
+        if (from == 0) {
+            constexpr T denorm_min = std::numeric_limits<T>::denorm_min();
+            return (to > 0) ? denorm_min : -denorm_min;
+        }
+        return nextafter_helper(has_bit_representation<T>{}, from, to);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Error-free transformations
+
+    // Unevaluated sum hi + lo of two floating point numbers
+    template<typename T>
+    struct float_pair
+    {
+        T hi;
+        T lo;
+    };
+
+    // Knuth's sum: hi is the rounded sum of a and b and lo its
+    // rounding error, valid when no overflow occurs
+    template<typename T>
+    constexpr auto two_sum(T a, T b)
+        -> float_pair<T>
+    {
+        const T s = a + b;
+        const T bv = s - a;
+        const T err = (a - (s - bv)) + (b - bv);
+        return { s, err };
+    }
+
+    // Veltkamp's split of x into two numbers holding at most half
+    // of the significant bits each
+    template<typename T>
+    constexpr auto split(T x)
+        -> float_pair<T>
+    {
+        constexpr T factor = pow2<T>((std::numeric_limits<T>::digits + 1) / 2) + 1;
+        const T c = factor * x;
+        const T hi = c - (c - x);
+        return { hi, x - hi };
+    }
+
+    // Dekker's product: hi is the rounded product of a and b and
+    // lo its rounding error, valid when no overflow or underflow
+    // occurs
+    template<typename T>
+    constexpr auto two_prod(T a, T b)
+        -> float_pair<T>
+    {
+        const T p = a * b;
+        const float_pair<T> as = split(a);
+        const float_pair<T> bs = split(b);
+        const T err = ((as.hi * bs.hi - p) + as.hi * bs.lo + as.lo * bs.hi) + as.lo * bs.lo;
+        return { p, err };
+    }
+}}
+
+#endif // SMATH_DETAIL_FLOATING_POINT_H_
@@ -36,11 +36,133 @@ namespace detail
                 is_prime_helper(n, div+2);
     }
 
-    template<typename T, typename U>
-    constexpr auto gcd_helper(T b, U r)
+    // Unsigned type able to hold the absolute value of any T
+    template<typename T, bool = std::is_signed<T>::value>
+    struct gcd_unsigned
+    {
+        using type = T;
+    };
+
+    template<typename T>
+    struct gcd_unsigned<T, true>:
+        std::make_unsigned<T>
+    {};
+
+    template<typename T>
+    constexpr auto unsigned_abs(T x)
+        -> typename gcd_unsigned<T>::type
+    {
+        using unsigned_type = typename gcd_unsigned<T>::type;
+        return (x < 0) ? static_cast<unsigned_type>(unsigned_type(0) - static_cast<unsigned_type>(x))
+                       : static_cast<unsigned_type>(x);
+    }
+
+    // Both engines take non-zero unsigned values
+
+    template<typename Unsigned>
+    constexpr auto gcd_helper(euclidean_gcd_t, Unsigned a, Unsigned b)
+        -> Unsigned
+    {
+        while (b != 0) {
+            const Unsigned r = a % b;
+            a = b;
+            b = r;
+        }
+        return a;
+    }
+
+    // Stein's algorithm: the common power of 2 is extracted once,
+    // then the greatest of both odd numbers is repeatedly replaced
+    // with the odd part of their difference; the trailing zeros of
+    // the difference are counted before knowing its sign, which
+    // shortens the dependency chain of the loop
+
+    template<typename Unsigned>
+    constexpr auto binary_gcd_step(Unsigned& a, Unsigned& b)
+        -> void
+    {
+        // The selections are done with masks: compilers tend to
+        // turn them into unpredictable branches otherwise
+        const Unsigned mask = static_cast<Unsigned>(Unsigned(0) - Unsigned(a > b));
+        const Unsigned diff = static_cast<Unsigned>(b - a);
+        const int zeros = countr_zero(diff);
+        a = static_cast<Unsigned>(a ^ ((a ^ b) & mask));
+        b = static_cast<Unsigned>(static_cast<Unsigned>((diff ^ mask) - mask) >> zeros);
+    }
+
+    template<typename Unsigned>
+    constexpr auto binary_gcd_odd(std::true_type, Unsigned a, Unsigned b)
+        -> Unsigned
+    {
+        while (a != b) {
+            binary_gcd_step(a, b);
+        }
+        return a;
+    }
+
+    // Types wider than unsigned long long switch to it as soon as
+    // both numbers fit, since they never grow
+    template<typename Unsigned>
+    constexpr auto binary_gcd_odd(std::false_type, Unsigned a, Unsigned b)
+        -> Unsigned
+    {
+        using narrow_type = unsigned long long;
+        constexpr int narrow_digits = std::numeric_limits<narrow_type>::digits;
+
+        while (((a | b) >> narrow_digits) != 0) {
+            if (a == b) {
+                return a;
+            }
+            binary_gcd_step(a, b);
+        }
+        return binary_gcd_odd(std::true_type{}, static_cast<narrow_type>(a), static_cast<narrow_type>(b));
+    }
+
+    template<typename Unsigned>
+    constexpr auto gcd_helper(binary_gcd_t, Unsigned a, Unsigned b)
+        -> Unsigned
+    {
+        using fits_narrow = std::integral_constant<
+            bool,
+            (std::numeric_limits<Unsigned>::digits <= std::numeric_limits<unsigned long long>::digits)
+        >;
+
+        const int a_zeros = countr_zero(a);
+        const int b_zeros = countr_zero(b);
+        const int shift = (a_zeros < b_zeros) ? a_zeros : b_zeros;
+        const Unsigned res = binary_gcd_odd(fits_narrow{},
+                                            static_cast<Unsigned>(a >> a_zeros),
+                                            static_cast<Unsigned>(b >> b_zeros));
+        return static_cast<Unsigned>(res << shift);
+    }
+
+    template<typename Algorithm, typename T, typename U>
+    constexpr auto gcd(Algorithm algorithm, T a, U b)
         -> std::common_type_t<T, U>
     {
-        return (r == 0) ? b : gcd_helper(r, b % r);
+        using common_type = std::common_type_t<T, U>;
+        using unsigned_type = typename gcd_unsigned<common_type>::type;
+        if (a == 0 || b == 0) {
+            return 0;
+        }
+        return static_cast<common_type>(gcd_helper(
+            algorithm,
+            static_cast<unsigned_type>(unsigned_abs(a)),
+            static_cast<unsigned_type>(unsigned_abs(b))
+        ));
+    }
+
+    // Dividing before multiplying means that the result only
+    // overflows when it is not representable
+    template<typename Algorithm, typename T, typename U>
+    constexpr auto lcm(Algorithm algorithm, T a, U b)
+        -> std::common_type_t<T, U>
+    {
+        using common_type = std::common_type_t<T, U>;
+        if (a == 0 || b == 0) {
+            return 1;
+        }
+        return static_cast<common_type>(a) / detail::gcd(algorithm, a, b) * static_cast<common_type>(b);
     }
 }
 
@@ -168,10 +290,21 @@ template<typename T, typename U>
 constexpr auto gcd(T a, U b)
     -> std::common_type_t<T, U>
 {
-    return (a == 0 || b == 0) ? 0 :
-        (a < 0 || b < 0) ? gcd(detail::abs(a), detail::abs(b)) :
-            (a >= b) ? detail::gcd_helper(b, a % b) :
-                detail::gcd_helper(a, b % a);
+    return detail::gcd(binary_gcd, a, b);
+}
+
+template<typename T, typename U>
+constexpr auto gcd(euclidean_gcd_t, T a, U b)
+    -> std::common_type_t<T, U>
+{
+    return detail::gcd(euclidean_gcd, a, b);
+}
+
+template<typename T, typename U>
+constexpr auto gcd(binary_gcd_t, T a, U b)
+    -> std::common_type_t<T, U>
+{
+    return detail::gcd(binary_gcd, a, b);
 }
 
 #ifndef STATIC_MATH_NO_INTEGRAL_CONSTANT
@@ -187,8 +320,21 @@ template<typename T, typename U>
 constexpr auto lcm(T a, U b)
     -> std::common_type_t<T, U>
 {
-    return (a == 0 || b == 0) ? 1 :
-        a * b / gcd(a, b);
+    return detail::lcm(binary_gcd, a, b);
+}
+
+template<typename T, typename U>
+constexpr auto lcm(euclidean_gcd_t, T a, U b)
+    -> std::common_type_t<T, U>
+{
+    return detail::lcm(euclidean_gcd, a, b);
+}
+
+template<typename T, typename U>
+constexpr auto lcm(binary_gcd_t, T a, U b)
+    -> std::common_type_t<T, U>
+{
+    return detail::lcm(binary_gcd, a, b);
 }
 
 #ifndef STATIC_MATH_NO_INTEGRAL_CONSTANT
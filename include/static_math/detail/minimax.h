@@ -0,0 +1,1438 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_DETAIL_MINIMAX_H_
+#define SMATH_DETAIL_MINIMAX_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "polynomial.h"
+
+// This header contains the coefficients of the minimax polynomials
+// used by the kernels of the mathematical functions on their reduced
+// range. They are specialized for the precision of the floating point
+// types (std::numeric_limits<T>::digits): 24 for float, 53 for double,
+// 64 and 113 for the usual extended and quadruple precision long double.
+// The coefficients of float kernels are stored as double since these
+// kernels are evaluated in double precision.
+//
+// The coefficients were generated with tools/minimax.py
+
+namespace smath
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // sin(x) = x + x^3 P(x^2) on [-pi/4, pi/4]
+
+    template<int Digits>
+    struct sin_minimax;
+
+    template<>
+    struct sin_minimax<24>
+    {
+        // 3 coefficients, max relative error 2^-27.2
+        static constexpr auto coefficients()
+            -> polynomial<double, 3>
+        {
+            return {{
+                -1.6666654675689307e-1,
+                8.3321010322320848e-3,
+                -1.950397261515054e-4,
+            }};
+        }
+    };
+
+    template<>
+    struct sin_minimax<53>
+    {
+        // 6 coefficients, max relative error 2^-57.94
+        static constexpr auto coefficients()
+            -> polynomial<double, 6>
+        {
+            return {{
+                -1.666666666666663e-1,
+                8.3333333333221182e-3,
+                -1.9841269829589205e-4,
+                2.7557313621274833e-6,
+                -2.5050747746145562e-8,
+                1.5896229222433272e-10,
+            }};
+        }
+    };
+
+    template<>
+    struct sin_minimax<64>
+    {
+        // 7 coefficients, max relative error 2^-68.74
+        static constexpr auto coefficients()
+            -> polynomial<long double, 7>
+        {
+            return {{
+                -1.666666666666666664e-1L,
+                8.33333333333332250526e-3L,
+                -1.98412698412547988408e-4L,
+                2.75573192140645118932e-6L,
+                -2.50521048817690448156e-8L,
+                1.60583631549601756201e-10L,
+                -7.57853982506183597654e-13L,
+            }};
+        }
+    };
+
+    template<>
+    struct sin_minimax<113>
+    {
+        // 12 coefficients, max relative error 2^-127.1
+        static constexpr auto coefficients()
+            -> polynomial<long double, 12>
+        {
+            return {{
+                -1.66666666666666666666666666666666658642e-1L,
+                8.333333333333333333333333333333119575171e-3L,
+                -1.984126984126984126984126984045287973406e-4L,
+                2.755731922398589065255731765489059788942e-6L,
+                -2.505210838544171877505034141831654073966e-8L,
+                1.605904383682161459812510437595008134372e-10L,
+                -7.647163731819815869692033752072530652091e-13L,
+                2.811457254345322882476397866155497797011e-15L,
+                -8.220635246181809859449407758632197599614e-18L,
+                1.957294039627171273191080734594484499165e-20L,
+                -3.868105353870899561221920997789288058996e-23L,
+                6.410290265077117348297295157146856357783e-26L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // cos(x) = 1 - x^2/2 + x^4 P(x^2) on [-pi/4, pi/4]
+
+    template<int Digits>
+    struct cos_minimax;
+
+    template<>
+    struct cos_minimax<24>
+    {
+        // 3 coefficients, max relative error 2^-31.83
+        static constexpr auto coefficients()
+            -> polynomial<double, 3>
+        {
+            return {{
+                4.1666654651191466e-2,
+                -1.3887654358800228e-3,
+                2.4463834874227971e-5,
+            }};
+        }
+    };
+
+    template<>
+    struct cos_minimax<53>
+    {
+        // 6 coefficients, max relative error 2^-62.14
+        static constexpr auto coefficients()
+            -> polynomial<double, 6>
+        {
+            return {{
+                4.166666666666665e-2,
+                -1.3888888888882844e-3,
+                2.4801587294633002e-5,
+                -2.7557315740535841e-7,
+                2.0875898059287614e-9,
+                -1.1368001225696719e-11,
+            }};
+        }
+    };
+
+    template<>
+    struct cos_minimax<64>
+    {
+        // 7 coefficients, max relative error 2^-73.08
+        static constexpr auto coefficients()
+            -> polynomial<long double, 7>
+        {
+            return {{
+                4.16666666666666666576e-2L,
+                -1.38888888888888840668e-3L,
+                2.48015873015797201527e-5L,
+                -2.75573192186649724429e-7L,
+                2.08767550513933774315e-9L,
+                -1.14703649620556061116e-11L,
+                4.74108723165497558954e-14L,
+            }};
+        }
+    };
+
+    template<>
+    struct cos_minimax<113>
+    {
+        // 11 coefficients, max relative error 2^-119.7
+        static constexpr auto coefficients()
+            -> polynomial<long double, 11>
+        {
+            return {{
+                4.166666666666666666666666666666653827134e-2L,
+                -1.388888888888888888888888888872155349602e-3L,
+                2.480158730158730158730158664797153530804e-5L,
+                -2.755731922398589065255613377625119968115e-7L,
+                2.087675698786809897800945717874988041711e-9L,
+                -1.147074559772972396763898944825918530175e-11L,
+                4.77947733238708629206801897883785646354e-14L,
+                -1.561920696779814925660474801528898274598e-16L,
+                4.110317487462406188664623498713900802458e-19L,
+                -8.896643920356716972151767855798498009068e-22L,
+                1.602585522235042885227891993052348695113e-24L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // log(1+f) = 2s + s^3 P(s^2) with s = f/(2+f) on [sqrt(1/2)-1, sqrt(2)-1]
+
+    template<int Digits>
+    struct log_minimax;
+
+    template<>
+    struct log_minimax<24>
+    {
+        // 3 coefficients, max relative error 2^-29.43
+        static constexpr auto coefficients()
+            -> polynomial<double, 3>
+        {
+            return {{
+                6.6666778244484681e-1,
+                3.9976084437273429e-1,
+                2.9925410361952148e-1,
+            }};
+        }
+    };
+
+    template<>
+    struct log_minimax<53>
+    {
+        // 7 coefficients, max relative error 2^-59.5
+        static constexpr auto coefficients()
+            -> polynomial<double, 7>
+        {
+            return {{
+                6.666666666666734e-1,
+                3.9999999999416358e-1,
+                2.8571428742016669e-1,
+                2.2222198610747929e-1,
+                1.8183562404509498e-1,
+                1.5314098885474772e-1,
+                1.4795474509542642e-1,
+            }};
+        }
+    };
+
+    template<>
+    struct log_minimax<64>
+    {
+        // 9 coefficients, max relative error 2^-73.96
+        static constexpr auto coefficients()
+            -> polynomial<long double, 9>
+        {
+            return {{
+                6.66666666666666667118e-1L,
+                3.99999999999999361248e-1L,
+                2.85714285714584713361e-1L,
+                2.22222222153647666788e-1L,
+                1.81818190706401042233e-1L,
+                1.53845459144318190371e-1L,
+                1.33366693847495255233e-1L,
+                1.16686830242908328866e-1L,
+                1.20338048075405528248e-1L,
+            }};
+        }
+    };
+
+    template<>
+    struct log_minimax<113>
+    {
+        // 15 coefficients, max relative error 2^-117.0
+        static constexpr auto coefficients()
+            -> polynomial<long double, 15>
+        {
+            return {{
+                6.666666666666666666666666666667968274321e-1L,
+                3.999999999999999999999999995438009970277e-1L,
+                2.857142857142857142857148469047801269669e-1L,
+                2.222222222222222222218723414083079747889e-1L,
+                1.818181818181818183116714078941358771568e-1L,
+                1.538461538461538147891843445503791030273e-1L,
+                1.333333333333385394952179415367594115581e-1L,
+                1.176470588229149887076369889895421743135e-1L,
+                1.052631579473444361039673351627163340594e-1L,
+                9.523809194009085447882654259555864451867e-2L,
+                8.6956672953312204410447943329480064337e-2L,
+                7.999499388590467228223928575032857397341e-2L,
+                7.419030303116225443432468588733509320632e-2L,
+                6.717844635789801473183252902892102478186e-2L,
+                8.064836194513399345795768906355996992199e-2L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // r coth(r/2) = 2 + r^2 P(r^2) on [-ln(2)/2, ln(2)/2]
+
+    template<int Digits>
+    struct exp_minimax;
+
+    template<>
+    struct exp_minimax<24>
+    {
+        // 2 coefficients, max relative error 2^-29.69
+        static constexpr auto coefficients()
+            -> polynomial<double, 2>
+        {
+            return {{
+                1.6666619171118877e-1,
+                -2.7659033316541006e-3,
+            }};
+        }
+    };
+
+    template<>
+    struct exp_minimax<53>
+    {
+        // 5 coefficients, max relative error 2^-60.73
+        static constexpr auto coefficients()
+            -> polynomial<double, 5>
+        {
+            return {{
+                1.6666666666666616e-1,
+                -2.7777777777053831e-3,
+                6.6137563186587352e-5,
+                -1.6533890293926957e-6,
+                4.1374875436242272e-8,
+            }};
+        }
+    };
+
+    template<>
+    struct exp_minimax<64>
+    {
+        // 6 coefficients, max relative error 2^-71.06
+        static constexpr auto coefficients()
+            -> polynomial<long double, 6>
+        {
+            return {{
+                1.66666666666666666197e-1L,
+                -2.77777777777768335639e-3L,
+                6.61375661319866649115e-5L,
+                -1.65343900988364014226e-6L,
+                4.17516955103812580908e-8L,
+                -1.04565894729031696072e-9L,
+            }};
+        }
+    };
+
+    template<>
+    struct exp_minimax<113>
+    {
+        // 11 coefficients, max relative error 2^-122.9
+        static constexpr auto coefficients()
+            -> polynomial<long double, 11>
+        {
+            return {{
+                1.666666666666666666666666666666664419748e-1L,
+                -2.777777777777777777777777777632141078587e-3L,
+                6.613756613756613756613753692113630222248e-5L,
+                -1.653439153439153439150717554650918600824e-6L,
+                4.175351397573619781683743433810757093255e-8L,
+                -1.056838027737494116852526798249942844058e-9L,
+                2.676507306127631236852968069900966149864e-11L,
+                -6.779360580044975045738559585696347109688e-13L,
+                1.717211294980225892409441114671431899623e-14L,
+                -4.349114312619864613687130527810095301266e-16L,
+                1.081892520972389679880792184893698855153e-17L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // R1(h) = 6/r (coth(r/2) - 2/r) = 1 + h P(h) with h = r^2/2 on [-ln(2)/2, ln(2)/2]
+
+    template<int Digits>
+    struct expm1_minimax;
+
+    template<>
+    struct expm1_minimax<24>
+    {
+        // 2 coefficients, max relative error 2^-30.18
+        static constexpr auto coefficients()
+            -> polynomial<double, 2>
+        {
+            return {{
+                -3.3333190863999142e-2,
+                1.580177387971239e-3,
+            }};
+        }
+    };
+
+    template<>
+    struct expm1_minimax<53>
+    {
+        // 5 coefficients, max relative error 2^-61.75
+        static constexpr auto coefficients()
+            -> polynomial<double, 5>
+        {
+            return {{
+                -3.3333333333333139e-2,
+                1.5873015872552745e-3,
+                -7.9365075813161884e-5,
+                4.0082184154888587e-6,
+                -2.0110367627821677e-7,
+            }};
+        }
+    };
+
+    template<>
+    struct expm1_minimax<64>
+    {
+        // 6 coefficients, max relative error 2^-72.13
+        static constexpr auto coefficients()
+            -> polynomial<long double, 6>
+        {
+            return {{
+                -3.33333333333333331316e-2L,
+                1.58730158730152251087e-3L,
+                -7.93650793580918283603e-5L,
+                4.00833699514560851002e-6L,
+                -2.02904209729602426162e-7L,
+                1.01704365384436099112e-8L,
+            }};
+        }
+    };
+
+    template<>
+    struct expm1_minimax<113>
+    {
+        // 11 coefficients, max relative error 2^-124.0
+        static constexpr auto coefficients()
+            -> polynomial<long double, 11>
+        {
+            return {{
+                -3.333333333333333333333333333333318848735e-2L,
+                1.587301587301587301587301587163078142759e-3L,
+                -7.936507936507936507936503289352395917016e-5L,
+                4.008337341670675004000561497594892692556e-6L,
+                -2.029129013255997375421785808938809813479e-7L,
+                1.027778805556578712613675545186015492105e-8L,
+                -5.20654893513297470422502697858285116695e-10L,
+                2.637638258756327967816890945319782769085e-11L,
+                -1.336238461992790044078733329512388369391e-12L,
+                6.768498320029976203169418793486620856763e-14L,
+                -3.367750365661158606479896018153589066563e-15L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // atan(x) = x + x^3 P(x^2) on [-7/16, 7/16]
+
+    template<int Digits>
+    struct atan_minimax;
+
+    template<>
+    struct atan_minimax<24>
+    {
+        // 5 coefficients, max relative error 2^-29.59
+        static constexpr auto coefficients()
+            -> polynomial<double, 5>
+        {
+            return {{
+                -3.3333303444431817e-1,
+                1.9997738077003008e-1,
+                -1.4229582572055477e-1,
+                1.0490809277082236e-1,
+                -5.8191020829106717e-2,
+            }};
+        }
+    };
+
+    template<>
+    struct atan_minimax<53>
+    {
+        // 11 coefficients, max relative error 2^-57.7
+        static constexpr auto coefficients()
+            -> polynomial<double, 11>
+        {
+            return {{
+                -3.3333333333332921e-1,
+                1.9999999999873677e-1,
+                -1.4285714272261774e-1,
+                1.1111110395072792e-1,
+                -9.0908868757879027e-2,
+                7.6918722442071832e-2,
+                -6.6610341602711301e-2,
+                5.8333242458817137e-2,
+                -4.9759161267940485e-2,
+                3.6510330147726047e-2,
+                -1.6265575870957436e-2,
+            }};
+        }
+    };
+
+    template<>
+    struct atan_minimax<64>
+    {
+        // 14 coefficients, max relative error 2^-71.57
+        static constexpr auto coefficients()
+            -> polynomial<long double, 14>
+        {
+            return {{
+                -3.33333333333333332909e-1L,
+                1.99999999999999793923e-1L,
+                -1.42857142857108308456e-1L,
+                1.11111111108179843488e-1L,
+                -9.09090907613909358901e-2L,
+                7.69230720956272585507e-2L,
+                -6.66665587146741712648e-2L,
+                5.88218226640547160489e-2L,
+                -5.26121392500325764643e-2L,
+                4.74583056003414552925e-2L,
+                -4.25157427852916377675e-2L,
+                3.58808431683511121912e-2L,
+                -2.47518506244622560504e-2L,
+                9.86239888259062010008e-3L,
+            }};
+        }
+    };
+
+    template<>
+    struct atan_minimax<113>
+    {
+        // 24 coefficients, max relative error 2^-117.5
+        static constexpr auto coefficients()
+            -> polynomial<long double, 24>
+        {
+            return {{
+                -3.333333333333333333333333333333149728012e-1L,
+                1.999999999999999999999999999756092383678e-1L,
+                -1.428571428571428571428571314110921680294e-1L,
+                1.111111111111111111111083547539436293936e-1L,
+                -9.090909090909090909050681865867934954778e-2L,
+                7.6923076923076923037783433442649495238e-2L,
+                -6.66666666666666639666947051210957459652e-2L,
+                5.882352941176456808515866532110816312302e-2L,
+                -5.263157894736305556604238263781779735606e-2L,
+                4.761904761888455944454891946244398905266e-2L,
+                -4.347826086563110780176292090671486993831e-2L,
+                3.999999992368298917562508907135023606619e-2L,
+                -3.703703583565031776655263749861633263869e-2L,
+                3.4482743175880105271014863066242782194e-2L,
+                -3.225790175368822975292235426511059818171e-2L,
+                3.030162237395618374740477281945930767682e-2L,
+                -2.856144239418645552815001050606740722171e-2L,
+                2.696915786480904520367135319450834502796e-2L,
+                -2.53687836330817056281202775231450889298e-2L,
+                2.336033210576868930602876005987064274807e-2L,
+                -2.016279462422181029278919957238449589452e-2L,
+                1.496516086134348189380642236994414106456e-2L,
+                -8.190285216164115535539929864429725002686e-3L,
+                2.385074374931592209462517904461312062106e-3L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // asin(x) = x + x^3 P(x^2) on [-1/2, 1/2]
+
+    template<int Digits>
+    struct asin_minimax;
+
+    template<>
+    struct asin_minimax<24>
+    {
+        // 6 coefficients, max relative error 2^-31.76
+        static constexpr auto coefficients()
+            -> polynomial<double, 6>
+        {
+            return {{
+                1.6666659992180366e-1,
+                7.5005041371503448e-2,
+                4.4516963199690375e-2,
+                3.1807659164347447e-2,
+                1.4438803655945961e-2,
+                3.7516202069927472e-2,
+            }};
+        }
+    };
+
+    template<>
+    struct asin_minimax<53>
+    {
+        // 13 coefficients, max relative error 2^-59.86
+        static constexpr auto coefficients()
+            -> polynomial<double, 13>
+        {
+            return {{
+                1.666666666666676e-1,
+                7.4999999999707953e-2,
+                4.464285717461583e-2,
+                3.0381942707621359e-2,
+                2.2372214991575736e-2,
+                1.735161195266301e-2,
+                1.3980821183720274e-2,
+                1.1398907638627548e-2,
+                1.0780275774796375e-2,
+                3.7063300712391715e-3,
+                2.1707622094527288e-2,
+                -2.0999290357108964e-2,
+                3.2628755423950828e-2,
+            }};
+        }
+    };
+
+    template<>
+    struct asin_minimax<64>
+    {
+        // 15 coefficients, max relative error 2^-67.75
+        static constexpr auto coefficients()
+            -> polynomial<long double, 15>
+        {
+            return {{
+                1.66666666666666671848e-1L,
+                7.49999999999978885393e-2L,
+                4.46428571431591442233e-2L,
+                3.03819444225723503554e-2L,
+                2.23721600326782766987e-2L,
+                1.73527380773505364607e-2L,
+                1.39653490679767893655e-2L,
+                1.15449312205174268899e-2L,
+                9.82907276612901562219e-3L,
+                7.90821023668627412445e-3L,
+                9.80970111157374930998e-3L,
+                -2.75931568139547686392e-3L,
+                2.89645565262143633405e-2L,
+                -3.17836654171442855011e-2L,
+                3.49409567468502355873e-2L,
+            }};
+        }
+    };
+
+    template<>
+    struct asin_minimax<113>
+    {
+        // 28 coefficients, max relative error 2^-118.4
+        static constexpr auto coefficients()
+            -> polynomial<long double, 28>
+        {
+            return {{
+                1.666666666666666666666666666666572456594e-1L,
+                7.500000000000000000000000001274346677448e-2L,
+                4.464285714285714285714285104996198827177e-2L,
+                3.03819444444444444444459416420487879953e-2L,
+                2.237215909090909090886742885628972470649e-2L,
+                1.735276442307692309923097774376481076902e-2L,
+                1.39648437499999984149566837167844580273e-2L,
+                1.155180089613978961179999250663816185254e-2L,
+                9.761609529190684614948938907587097769569e-3L,
+                8.390335809724966977898683580740708896674e-3L,
+                7.312525870840506870108789966518443798374e-3L,
+                6.447210369001320700161802592940022242956e-3L,
+                5.740036700373265906219643377319107606271e-3L,
+                5.153323327810120838593697532345477610103e-3L,
+                4.659983771787072683559223554308704352427e-3L,
+                4.24246945796317604606373118514939285295e-3L,
+                3.868164513777015996424792056514420008681e-3L,
+                3.657053814703459834824819173287279121084e-3L,
+                2.792876244745671751057331458036704242691e-3L,
+                5.467952602843391966370613224714644877731e-3L,
+                -6.685815454858444135117790706342997445051e-3L,
+                3.353245827659320178292608929350393541285e-2L,
+                -7.819576032769298312515560929282617679233e-2L,
+                1.687422066940210549724284724217197712194e-1L,
+                -2.596536795397401559858625006415352299241e-1L,
+                2.996099461500629373496584344500437846118e-1L,
+                -2.183488918741234324942969654435395345624e-1L,
+                8.458433309377058262187553362486673902621e-2L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // erf(x) = x + x P(x^2) on [-1/2, 1/2]
+
+    template<int Digits>
+    struct erf_minimax;
+
+    template<>
+    struct erf_minimax<24>
+    {
+        // 5 coefficients, max relative error 2^-29.46
+        static constexpr auto coefficients()
+            -> polynomial<double, 5>
+        {
+            return {{
+                1.2837916556650539e-1,
+                -3.7612608568754247e-1,
+                1.1282822746149859e-1,
+                -2.6757180496303653e-2,
+                4.7179827002075221e-3,
+            }};
+        }
+    };
+
+    template<>
+    struct erf_minimax<53>
+    {
+        // 9 coefficients, max relative error 2^-57.82
+        static constexpr auto coefficients()
+            -> polynomial<double, 9>
+        {
+            return {{
+                1.2837916709551256e-1,
+                -3.7612638903183465e-1,
+                1.1283791670924802e-1,
+                -2.6866170632713009e-2,
+                5.2239773702890489e-3,
+                -8.5482975215708508e-4,
+                1.205332419221699e-4,
+                -1.4845580971806097e-5,
+                1.4723189417242003e-6,
+            }};
+        }
+    };
+
+    template<>
+    struct erf_minimax<64>
+    {
+        // 11 coefficients, max relative error 2^-72.88
+        static constexpr auto coefficients()
+            -> polynomial<long double, 11>
+        {
+            return {{
+                1.28379167095512573902e-1L,
+                -3.76126389031837524499e-1L,
+                1.12837916709551237473e-1L,
+                -2.68661706451300131077e-2L,
+                5.22397762540263778359e-3L,
+                -8.54832701607673723593e-4L,
+                1.20553321237127340694e-4L,
+                -1.49255861415730489389e-5L,
+                1.64590201370977757769e-6L,
+                -1.62728722937032971984e-7L,
+                1.32122509482317969169e-8L,
+            }};
+        }
+    };
+
+    template<>
+    struct erf_minimax<113>
+    {
+        // 17 coefficients, max relative error 2^-120.6
+        static constexpr auto coefficients()
+            -> polynomial<long double, 17>
+        {
+            return {{
+                1.283791670955125738961589031215451667741e-1L,
+                -3.761263890318375246320529677071803901565e-1L,
+                1.128379167095512573896158903116528311862e-1L,
+                -2.68661706451312517594323547602287039202e-2L,
+                5.223977625442187842111840710534826977655e-3L,
+                -8.548327023450852832543722354768626974192e-4L,
+                1.205533298178966425008954898378935497911e-4L,
+                -1.492565035840625076918316874532331879235e-5L,
+                1.646211436588921411180697564946038732306e-6L,
+                -1.636584469123101027593728714331411896384e-7L,
+                1.480719281553646822117721435248136888116e-8L,
+                -1.229055527927185129162564124797693402723e-9L,
+                9.422757970120370520217131152209576301304e-11L,
+                -6.711327684796095351394852336580556700242e-12L,
+                4.462224658221226486009415971978111545e-13L,
+                -2.766264742791327032808175531327969810244e-14L,
+                1.45271129804055774602152120311122674039e-15L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // exp(x^2) erfc(x) = P(x - 1) on [1/2, 3/2]
+
+    template<int Digits>
+    struct erfcx_near_minimax;
+
+    template<>
+    struct erfcx_near_minimax<24>
+    {
+        // 9 coefficients, max relative error 2^-27.07
+        static constexpr auto coefficients()
+            -> polynomial<double, 9>
+        {
+            return {{
+                4.2758357571109823e-1,
+                -2.7321196028677208e-1,
+                1.5437159987920951e-1,
+                -7.922990217489205e-2,
+                3.7572161422033686e-2,
+                -1.6619560866506605e-2,
+                6.9628284496848405e-3,
+                -2.9928127447455925e-3,
+                1.1134246962535858e-3,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_near_minimax<53>
+    {
+        // 17 coefficients, max relative error 2^-56.43
+        static constexpr auto coefficients()
+            -> polynomial<double, 17>
+        {
+            return {{
+                4.27583576155807e-1,
+                -2.7321201478389839e-1,
+                1.543715613719088e-1,
+                -7.9226968941355447e-2,
+                3.7572296215263944e-2,
+                -1.6661869088797573e-2,
+                6.9701423756300899e-3,
+                -2.7690648166615859e-3,
+                1.0502693934542312e-3,
+                -3.8195398262364579e-4,
+                1.3366297397321937e-4,
+                -4.5148042942528374e-5,
+                1.4753605649454842e-5,
+                -4.657805269987377e-6,
+                1.4365171891412748e-6,
+                -4.7138568646348791e-7,
+                1.3536509929114599e-7,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_near_minimax<64>
+    {
+        // 20 coefficients, max relative error 2^-68.05
+        static constexpr auto coefficients()
+            -> polynomial<long double, 20>
+        {
+            return {{
+                4.27583576155807004406e-1L,
+                -2.7321201478389856509e-1L,
+                1.54371561371908440442e-1L,
+                -7.9226968941326748331e-2L,
+                3.75722962152906969368e-2L,
+                -1.66618690904144969946e-2L,
+                6.97014237496641827783e-3L,
+                -2.76906477584086258921e-3L,
+                1.05026939958047091083e-3L,
+                -3.81954528059533266456e-4L,
+                1.33662977318844837425e-4L,
+                -4.51439186355035265419e-5L,
+                1.47531489281440959977e-5L,
+                -4.67549795103103750448e-6L,
+                1.43981981720263556874e-6L,
+                -4.31461400176659469913e-7L,
+                1.25514785427119396201e-7L,
+                -3.58419912012128004514e-8L,
+                1.09641497673382352611e-8L,
+                -2.93980387135084382471e-9L,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_near_minimax<113>
+    {
+        // 32 coefficients, max relative error 2^-116.9
+        static constexpr auto coefficients()
+            -> polynomial<long double, 32>
+        {
+            return {{
+                4.275835761558070044107503444905151882797e-1L,
+                -2.732120147838985650746582141405148383629e-1L,
+                1.54371561371908439336092130350006007336e-1L,
+                -7.92269689413267504923773891936537842257e-2L,
+                3.757229621529084442185737057623478620827e-2L,
+                -1.666186909041436242820800745032236153077e-2L,
+                6.970142374958827331216454637558941667769e-3L,
+                -2.769064775844438599140443384946782265068e-3L,
+                1.050269399778597183018984220355128773563e-3L,
+                -3.819545280146314258047812844361892654162e-4L,
+                1.336629743527931514436371646283169701507e-4L,
+                -4.514391884760695897440431022010189502781e-5L,
+                1.475317591753103205581771651496084336079e-5L,
+                -4.675498912319373378215818583142339356781e-6L,
+                1.439668143601665959841384266722459823182e-6L,
+                -4.314441024956942559633788831575133742201e-7L,
+                1.260280051382404486424666893678298260885e-7L,
+                -3.593130557146552056011881391743844124485e-8L,
+                1.001074439636887690992335518646784226964e-8L,
+                -2.728480123695083677827906222872063433266e-9L,
+                7.282264268200384815517368447163688089574e-10L,
+                -1.905003520519400773865258724668635166396e-10L,
+                4.888419103794172418282993131096469285542e-11L,
+                -1.231444907099490078874066650264123628007e-11L,
+                3.047468995995747017642931403051402180464e-12L,
+                -7.413568945423896640164595173055752403755e-13L,
+                1.77419487378078995684807826328211275972e-13L,
+                -4.177822208092428270665487591947042036978e-14L,
+                9.640236895227675123417831322687375737311e-15L,
+                -2.205602160575583799401578350411604010282e-15L,
+                5.491734704662057563966071346457848311918e-16L,
+                -1.201987150204374557973635252067644293703e-16L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // exp(x^2) erfc(x) = P(x - 9/4) on [3/2, 3]
+
+    template<int Digits>
+    struct erfcx_mid_minimax;
+
+    template<>
+    struct erfcx_mid_minimax<24>
+    {
+        // 10 coefficients, max relative error 2^-29.72
+        static constexpr auto coefficients()
+            -> polynomial<double, 10>
+        {
+            return {{
+                2.3108725899116192e-1,
+                -8.8486502586929569e-2,
+                3.1992604060622119e-2,
+                -1.1002061552927302e-2,
+                3.6193279294406775e-3,
+                -1.143771279662621e-3,
+                3.4688802272953327e-4,
+                -1.0239429285208562e-4,
+                3.2644798812225088e-5,
+                -8.9315625798525336e-6,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_mid_minimax<53>
+    {
+        // 18 coefficients, max relative error 2^-57.26
+        static constexpr auto coefficients()
+            -> polynomial<double, 18>
+        {
+            return {{
+                2.3108725873039188e-1,
+                -8.848650280874916e-2,
+                3.1992627410705875e-2,
+                -1.1002060756440278e-2,
+                3.6189953543764039e-3,
+                -1.1437284836499321e-3,
+                3.4853542171044415e-4,
+                -1.0272108117112084e-4,
+                2.9353250427908948e-5,
+                -8.1502834026569514e-6,
+                2.2030062789638769e-6,
+                -5.8063165979832968e-7,
+                1.4948007390556625e-7,
+                -3.7608639412435837e-8,
+                9.1790378515104023e-9,
+                -2.2201730452032321e-9,
+                6.0539352797025276e-10,
+                -1.3855541496654805e-10,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_mid_minimax<64>
+    {
+        // 21 coefficients, max relative error 2^-68.03
+        static constexpr auto coefficients()
+            -> polynomial<long double, 21>
+        {
+            return {{
+                2.31087258730391869959e-1L,
+                -8.8486502808749159067e-2L,
+                3.19926274107062620429e-2L,
+                -1.10020607564400491648e-2L,
+                3.61899535435807735023e-3L,
+                -1.14372848365364010464e-3L,
+                3.48535422045740088388e-4L,
+                -1.02721081159293529495e-4L,
+                2.93532473602483187217e-5L,
+                -8.15028322528835305454e-6L,
+                2.20302201216436030415e-6L,
+                -5.80633509760001154144e-7L,
+                1.49432817327051577813e-7L,
+                -3.7601085138963578053e-8L,
+                9.26131020547651274783e-9L,
+                -2.23601426589022658421e-9L,
+                5.29175100826726085282e-10L,
+                -1.21670133215360402341e-10L,
+                2.78348789940437455056e-11L,
+                -7.25548552484765518637e-12L,
+                1.57762484821727067467e-12L,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_mid_minimax<113>
+    {
+        // 34 coefficients, max relative error 2^-116.8
+        static constexpr auto coefficients()
+            -> polynomial<long double, 34>
+        {
+            return {{
+                2.310872587303918699574998928966072855133e-1L,
+                -8.848650280874915908740938508681235789026e-2L,
+                3.199262741070626201082877645127784622899e-2L,
+                -1.100206075644004637536309204762554286268e-2L,
+                3.618995354358078833130909672341820417946e-3L,
+                -1.143728483653747600327418113908215476736e-3L,
+                3.485354220457155774647396195915833690038e-4L,
+                -1.027210811573964431519297052882027341051e-4L,
+                2.935324736039339509322512657508430010452e-5L,
+                -8.150283243669178709371882721953149900167e-6L,
+                2.203022012427548599412949524802139952799e-6L,
+                -5.806334028558535201237652491817763838991e-7L,
+                1.49432809333646363399088324736811707956e-7L,
+                -3.760147413156141580400330770364727189331e-8L,
+                9.261356076804737610602454434255607902589e-9L,
+                -2.23512306116676705633953694461723791759e-9L,
+                5.290411486474537955482632826425100935524e-10L,
+                -1.229153502011793857663724811408188928903e-10L,
+                2.805351229934455243695463912032427117321e-11L,
+                -6.294205002892040764345161410765668187184e-12L,
+                1.389155104586696607501141661362321128147e-12L,
+                -3.017720017510734293875946797738758478826e-13L,
+                6.456073553963314348045068677198210966976e-14L,
+                -1.360959513771752160061890624932430860077e-14L,
+                2.82826412025505160401869559185323413671e-15L,
+                -5.796805954038196340618231444829988325608e-16L,
+                1.172264046123389058804496318588737873343e-16L,
+                -2.340071123604740845068631706321713347013e-17L,
+                4.615922165395162440983930499847680150442e-18L,
+                -8.985699608502130843717527198645856062963e-19L,
+                1.703273120611811385813952686284864805921e-19L,
+                -3.247816414897242015050235266487935587734e-20L,
+                7.279524383252669684115116471393808375947e-21L,
+                -1.334836545889565766996501001353863322526e-21L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // x exp(x^2) erfc(x) = P(1/x^2) on [3, inf)
+
+    template<int Digits>
+    struct erfcx_far_minimax;
+
+    template<>
+    struct erfcx_far_minimax<24>
+    {
+        // 7 coefficients, max relative error 2^-28.39
+        static constexpr auto coefficients()
+            -> polynomial<double, 7>
+        {
+            return {{
+                5.6418958194591007e-1,
+                -2.8209327386307326e-1,
+                4.2290525474211021e-1,
+                -1.043671731672196,
+                3.2787988767063294,
+                -9.4836458801494707,
+                1.5428693291375472e+1,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_far_minimax<53>
+    {
+        // 18 coefficients, max relative error 2^-57.2
+        static constexpr auto coefficients()
+            -> polynomial<double, 18>
+        {
+            return {{
+                5.6418958354775628e-1,
+                -2.8209479177385705e-1,
+                4.231421876392068e-1,
+                -1.0578554603498111,
+                3.7024922416958241,
+                -1.6660972198829906e+1,
+                9.1614480244604991e+1,
+                -5.9424312979030503e+2,
+                4.4025812820356814e+3,
+                -3.5680089161260628e+4,
+                2.969168329472937e+5,
+                -2.3491598982704207e+6,
+                1.6375267257684126e+7,
+                -9.3895508147255212e+7,
+                4.1445830397365052e+8,
+                -1.3012682536014161e+9,
+                2.563873572767817e+9,
+                -2.3697699499627895e+9,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_far_minimax<64>
+    {
+        // 23 coefficients, max relative error 2^-68.18
+        static constexpr auto coefficients()
+            -> polynomial<long double, 23>
+        {
+            return {{
+                5.64189583547756286924e-1L,
+                -2.82094791773878126521e-1L,
+                4.23142187660788991771e-1L,
+                -1.05785546913330581406L,
+                3.70249413540997773429L,
+                -1.66612221962600717609e+1L,
+                9.16365182034601498257e+1L,
+                -5.95616516313859931442e+2L,
+                4.46555058759180906058e+3L,
+                -3.78670721651534277008e+4L,
+                3.55737224742268305334e+5L,
+                -3.59552893812118091091e+6L,
+                3.74681961299014846882e+7L,
+                -3.82074480460444561089e+8L,
+                3.61730600309156473423e+9L,
+                -3.03584088017206717394e+10L,
+                2.17169367931282532796e+11L,
+                -1.27809031625624398148e+12L,
+                5.96448917045063721037e+12L,
+                -2.10906396302758088169e+13L,
+                5.28646641305741380501e+13L,
+                -8.34466700073668461533e+13L,
+                6.22379803921171624641e+13L,
+            }};
+        }
+    };
+
+    template<>
+    struct erfcx_far_minimax<113>
+    {
+        // 49 coefficients, max relative error 2^-116.0
+        static constexpr auto coefficients()
+            -> polynomial<long double, 49>
+        {
+            return {{
+                5.641895835477562869480794515607725352388e-1L,
+                -2.820947917738781434740397257800737854859e-1L,
+                4.231421876608172152110595863572579654145e-1L,
+                -1.057855469152043038027642088687486606609L,
+                3.702494142032150633085795803882355535421L,
+                -1.66612236391446778380591554638833450128e+1L,
+                9.163673001529572083713608843001186047148e+1L,
+                -5.956387450994186591775920196648467731738e+2L,
+                4.467290588244350585632206881957278840728e+3L,
+                -3.797196999970965792574566672543519099336e+4L,
+                3.607337149136115954756637924156493849126e+5L,
+                -3.787703991065348782135225962453829116966e+6L,
+                4.355859350721809757482499911450899914703e+7L,
+                -5.444821097017530091216891738097330144349e+8L,
+                7.350474497087995727140964045947005633657e+9L,
+                -1.065786745341408991140133368806486871428e+11L,
+                1.65170786159300389512262532218570560521e+12L,
+                -2.72345836028054733675082739640916633004e+13L,
+                4.754466944326560666872174581888377503484e+14L,
+                -8.732185841345077849300523493089881341134e+15L,
+                1.671904605873098383431080198604488651348e+17L,
+                -3.29426244778988480733052661131306404485e+18L,
+                6.570998354617075683859465260544618558924e+19L,
+                -1.302774996006127851348558047008644052767e+21L,
+                2.521180204115764328493513980138540500775e+22L,
+                -4.685832505788368286485080810879858909175e+23L,
+                8.251472893497726749601140898823662661016e+24L,
+                -1.361832527288172946629778296623133122921e+26L,
+                2.088572937112539795680231855405963420868e+27L,
+                -2.956413019564421836695039722152397155762e+28L,
+                3.841253167097983107357919528844428100586e+29L,
+                -4.559677645696713246305294750934692382812e+30L,
+                4.923968695281570221112825375389521875e+31L,
+                -4.81798437649431122090939857403257375e+32L,
+                4.2541550711912671294057495840702045e+33L,
+                -3.3750200578018134919042921385995808e+34L,
+                2.39425990630921334387658724874824352e+35L,
+                -1.510494137111954703066349266582762752e+36L,
+                8.420398173971179493276820131330146304e+36L,
+                -4.1159946740092270000012031247250587648e+37L,
+                1.74769286214407051790054031852326354944e+38L,
+                -6.37093398841773173279442534862394949632e+38L,
+                1.964033626690880512496215886109220012032e+39L,
+                -5.019360956735591898956418057644197019648e+39L,
+                1.034585238717733750372409750288714642227e+40L,
+                -1.652225022907621479308910454924326941491e+40L,
+                1.91786894702482879145126712679876001792e+40L,
+                -1.439287018573364029898867193617114254541e+40L,
+                5.240752808380501747218093890128131391488e+39L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // gamma(3/2+t) = 1 + (t+1/2) (t-1/2) P(t) on [-1/2, 1/2]
+
+    template<int Digits>
+    struct gamma_minimax;
+
+    template<>
+    struct gamma_minimax<24>
+    {
+        // 11 coefficients, max relative error 2^-27.39
+        static constexpr auto coefficients()
+            -> polynomial<double, 11>
+        {
+            return {{
+                4.550922976994532e-1,
+                -1.2935364550712014e-1,
+                1.6111551375824254e-1,
+                -8.8230711684069124e-2,
+                6.5873953493282345e-2,
+                -4.2946106162114736e-2,
+                2.9179868347623057e-2,
+                -1.8517748962081467e-2,
+                1.2224073701529992e-2,
+                -1.1911486333142313e-2,
+                8.2079734882291207e-3,
+            }};
+        }
+    };
+
+    template<>
+    struct gamma_minimax<53>
+    {
+        // 23 coefficients, max relative error 2^-57.91
+        static constexpr auto coefficients()
+            -> polynomial<double, 23>
+        {
+            return {{
+                4.5509229818896796e-1,
+                -1.2935358979554012e-1,
+                1.6111537800266748e-1,
+                -8.8235140923044714e-2,
+                6.5880075832114804e-2,
+                -4.2848354495631916e-2,
+                2.9079088064973054e-2,
+                -1.938567562007296e-2,
+                1.2965926229504118e-2,
+                -8.6529340459225966e-3,
+                5.7736482887364377e-3,
+                -3.850820484923675e-3,
+                2.5679431711321155e-3,
+                -1.7128768844769178e-3,
+                1.1421993944460314e-3,
+                -7.5725879361967618e-4,
+                5.0407816684040448e-4,
+                -3.5511576782010478e-4,
+                2.3907409626740565e-4,
+                -1.058087777777432e-4,
+                6.661680401194887e-5,
+                -1.3025423148762524e-4,
+                8.969145758787626e-5,
+            }};
+        }
+    };
+
+    template<>
+    struct gamma_minimax<64>
+    {
+        // 27 coefficients, max relative error 2^-68.08
+        static constexpr auto coefficients()
+            -> polynomial<long double, 27>
+        {
+            return {{
+                4.55092298188967945405e-1L,
+                -1.29353589795540055389e-1L,
+                1.61115378002667109124e-1L,
+                -8.82351409230713371103e-2L,
+                6.58800758321821535203e-2L,
+                -4.28483544928740575794e-2L,
+                2.90790880600348947983e-2L,
+                -1.93856757516553028059e-2L,
+                1.29659264164917305727e-2L,
+                -8.65293056768517919261e-3L,
+                5.7736441169315432508e-3L,
+                -3.8508764443252816537e-3L,
+                2.56800201502858986112e-3L,
+                -1.71230192081320323937e-3L,
+                1.14165563366252947911e-3L,
+                -7.61096635941913771114e-4L,
+                5.0740165767568575139e-4L,
+                -3.38681560526501158481e-4L,
+                2.25874069722880263649e-4L,
+                -1.48490488119987084974e-4L,
+                9.86851997623545434448e-5L,
+                -7.3137776737975349718e-5L,
+                4.94974244537837554927e-5L,
+                -1.62487642928227413619e-5L,
+                9.80386567973846067335e-6L,
+                -2.88953677846999339996e-5L,
+                1.98970089302063874228e-5L,
+            }};
+        }
+    };
+
+    template<>
+    struct gamma_minimax<113>
+    {
+        // 46 coefficients, max relative error 2^-116.4
+        static constexpr auto coefficients()
+            -> polynomial<long double, 46>
+        {
+            return {{
+                4.550922981889679454036650333177096227433e-1L,
+                -1.293535897955400553154795370758812977496e-1L,
+                1.611153780026671086945096408253959424455e-1L,
+                -8.82351409230713745117503227445789665592e-2L,
+                6.588007583218226262470972229822871694965e-2L,
+                -4.284835449286868426829200535947614193564e-2L,
+                2.907908806002389248208393447968545816254e-2L,
+                -1.938567575201421606496372755311305972775e-2L,
+                1.296592641707075435353621913476862998673e-2L,
+                -8.652930554198363996533357736709718009747e-3L,
+                5.773644098686104023182188695929097399125e-3L,
+                -3.85087675982714133568581755904356359974e-3L,
+                2.568002387094865932070515472577272812266e-3L,
+                -1.712297049869740959838745332344183420371e-3L,
+                1.141650493218393940964086043450795131166e-3L,
+                -7.611479149812503579305779331453797363915e-4L,
+                5.074510042676685565109531922470628635905e-4L,
+                -3.383082956849578692987226776058678667349e-4L,
+                2.255419154879277259388063793432863701292e-4L,
+                -1.503624979374402955131587557424904612531e-4L,
+                1.002421537575969473814191719485642427597e-4L,
+                -6.682829791505647067228723781103388816152e-5L,
+                4.455227675343949513628536271847679500814e-5L,
+                -2.970154909514678201336261502881875283734e-5L,
+                1.980104555939485831608320884228031320468e-5L,
+                -1.320070214913075777871632148357446164485e-5L,
+                8.800467058486916450124921871767133965681e-6L,
+                -5.866977994051797340901942922825281299802e-6L,
+                3.911342186995241538498678231807337945994e-6L,
+                -2.607566987336360494306335824256211691599e-6L,
+                1.738235800587084321315959508537201927659e-6L,
+                -1.158796367104120178642810374468988240226e-6L,
+                7.732290040888552916060390823666789656627e-7L,
+                -5.155969782141317963506991103412966101246e-7L,
+                3.410112826363437129842969979501902467406e-7L,
+                -2.269915442325566192045606043231128897706e-7L,
+                1.596241744155935646662628008132784982044e-7L,
+                -1.072556877278113860105801550578588620317e-7L,
+                5.213408919129216645299436384326556190815e-8L,
+                -3.326888251032199633694093187743608511086e-8L,
+                5.557968071973944513468403514466669186405e-8L,
+                -3.888201944447490292286182773396695874104e-8L,
+                -1.414112996331829322106055113496997945727e-8L,
+                1.082141878371092992734745216356239974232e-8L,
+                2.261992437566898240933411437177938730601e-8L,
+                -1.557578103074852012925604929325450518134e-8L,
+            }};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // lgamma(x) = (x-1/2) log(x) - x + log(2 pi)/2 + P(1/x^2)/x on [12, inf)
+
+    template<int Digits>
+    struct lgamma_minimax;
+
+    template<>
+    struct lgamma_minimax<24>
+    {
+        // 2 coefficients, max relative error 2^-32.24
+        static constexpr auto coefficients()
+            -> polynomial<double, 2>
+        {
+            return {{
+                8.3333321468105584e-2,
+                -2.770927514865614e-3,
+            }};
+        }
+    };
+
+    template<>
+    struct lgamma_minimax<53>
+    {
+        // 5 coefficients, max relative error 2^-58.57
+        static constexpr auto coefficients()
+            -> polynomial<double, 5>
+        {
+            return {{
+                8.3333333333333023e-2,
+                -2.7777777768820031e-3,
+                7.9365006761200878e-4,
+                -5.9499732453549201e-4,
+                8.0658896761432277e-4,
+            }};
+        }
+    };
+
+    template<>
+    struct lgamma_minimax<64>
+    {
+        // 7 coefficients, max relative error 2^-73.1
+        static constexpr auto coefficients()
+            -> polynomial<long double, 7>
+        {
+            return {{
+                8.33333333333333333153e-2L,
+                -2.77777777777768160113e-3L,
+                7.93650793500323197298e-4L,
+                -5.95237991290497341554e-4L,
+                8.41713874473225005097e-4L,
+                -1.91044369440507637535e-3L,
+                5.70836669835117671936e-3L,
+            }};
+        }
+    };
+
+    template<>
+    struct lgamma_minimax<113>
+    {
+        // 15 coefficients, max relative error 2^-119.1
+        static constexpr auto coefficients()
+            -> polynomial<long double, 15>
+        {
+            return {{
+                8.333333333333333333333333333333279969024e-2L,
+                -2.777777777777777777777777765361105897472e-3L,
+                7.936507936507936507935648624565531156812e-4L,
+                -5.952380952380952378166592983040242937594e-4L,
+                8.417508417508412370940197756926492267596e-4L,
+                -1.917526917526318396976010241703587076794e-3L,
+                6.410256409785293317383542924763987420446e-3L,
+                -2.955065333464509457500571741133720664844e-2L,
+                1.79644268944826449580872103157299839006e-1L,
+                -1.392402195457307617961635721956528559227L,
+                1.339647531174409106388966631846724580749e+1L,
+                -1.558568204022747162808528807857269583281e+2L,
+                2.082647676684053744210008444512462472648e+3L,
+                -2.751923465365235980555227186368867905506e+4L,
+                2.434623675579064850149671642108719355937e+5L,
+            }};
+        }
+    };
+}}
+
+#endif // SMATH_DETAIL_MINIMAX_H_
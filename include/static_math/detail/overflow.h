@@ -0,0 +1,195 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_DETAIL_OVERFLOW_H_
+#define SMATH_DETAIL_OVERFLOW_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <limits>
+#include <type_traits>
+#include "config.h"
+
+// This header contains constexpr helpers to detect the overflow
+// of integer operations and to find integer types wide enough
+// to hold the result of an operation without overflowing
+
+namespace smath
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Wider integer types
+
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef __int128 int128_type;
+    __extension__ typedef unsigned __int128 uint128_type;
+#endif
+
+    template<typename T, typename... Candidates>
+    struct widened_among
+    {
+        using type = void;
+    };
+
+    template<typename T, typename Candidate, typename... Candidates>
+    struct widened_among<T, Candidate, Candidates...>
+    {
+        using type = std::conditional_t<
+            std::is_integral<Candidate>::value
+                && std::numeric_limits<Candidate>::digits >= 2 * std::numeric_limits<T>::digits,
+            Candidate,
+            typename widened_among<T, Candidates...>::type
+        >;
+    };
+
+    /**
+     * @brief Smallest integer type at least twice as wide as T.
+     *
+     * The selected type has the same signedness as T and can hold
+     * the product of any two values of T. The type is void when no
+     * such type exists, for example for 64-bit integers when the
+     * compiler doesn't provide 128-bit integers as integral types.
+     */
+    template<typename T>
+    struct widened:
+        std::conditional_t<
+            std::is_signed<T>::value,
+            widened_among<T, int, long long
+#ifdef __SIZEOF_INT128__
+                          , int128_type
+#endif
+            >,
+            widened_among<T, unsigned, unsigned long long
+#ifdef __SIZEOF_INT128__
+                          , uint128_type
+#endif
+            >
+        >
+    {};
+
+    template<typename T>
+    using widened_t = typename widened<T>::type;
+
+    template<template<typename> class Template, typename T>
+    struct apply_widened
+    {
+        static_assert(!std::is_void<widened_t<T>>::value,
+                      "there is no integer type wide enough to widen this type");
+
+        using type = Template<widened_t<T>>;
+    };
+
+    template<template<typename> class Template, typename T>
+    using apply_widened_t = typename apply_widened<Template, T>::type;
+
+    ////////////////////////////////////////////////////////////
+    // Overflow-checked arithmetic
+    //
+    // These functions store the result of the operation in res
+    // and return whether it overflowed, in which case res holds
+    // the result wrapped around modulo 2^N
+
+    template<typename T>
+    constexpr auto add_overflow(T lhs, T rhs, T& res)
+        -> bool
+    {
+#ifdef STATIC_MATH_HAS_BUILTIN_OVERFLOW
+        return __builtin_add_overflow(lhs, rhs, &res);
+#else
+        using unsigned_type = std::make_unsigned_t<T>;
+        res = static_cast<T>(static_cast<unsigned_type>(lhs) + static_cast<unsigned_type>(rhs));
+        return (rhs > 0) ? (lhs > std::numeric_limits<T>::max() - rhs)
+                         : (lhs < std::numeric_limits<T>::min() - rhs);
+#endif
+    }
+
+    template<typename T>
+    constexpr auto sub_overflow(T lhs, T rhs, T& res)
+        -> bool
+    {
+#ifdef STATIC_MATH_HAS_BUILTIN_OVERFLOW
+        return __builtin_sub_overflow(lhs, rhs, &res);
+#else
+        using unsigned_type = std::make_unsigned_t<T>;
+        res = static_cast<T>(static_cast<unsigned_type>(lhs) - static_cast<unsigned_type>(rhs));
+        return (rhs > 0) ? (lhs < std::numeric_limits<T>::min() + rhs)
+                         : (lhs > std::numeric_limits<T>::max() + rhs);
+#endif
+    }
+
+#ifndef STATIC_MATH_HAS_BUILTIN_OVERFLOW
+    // When a wider type exists, the product is computed exactly
+    // and compared to the bounds of T, otherwise the magnitude of
+    // one operand is compared to the bound divided by the other
+
+    template<typename T>
+    constexpr auto mul_overflow_helper(std::true_type, T lhs, T rhs, T& res)
+        -> bool
+    {
+        using wide_type = widened_t<T>;
+        const wide_type product = static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs);
+        res = static_cast<T>(product);
+        return product < static_cast<wide_type>(std::numeric_limits<T>::min())
+            || product > static_cast<wide_type>(std::numeric_limits<T>::max());
+    }
+
+    template<typename T>
+    constexpr auto mul_overflow_helper(std::false_type, T lhs, T rhs, T& res)
+        -> bool
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        const bool negative = (lhs < 0) != (rhs < 0);
+        const unsigned_type lhs_abs = (lhs < 0) ? unsigned_type(0) - static_cast<unsigned_type>(lhs)
+                                                : static_cast<unsigned_type>(lhs);
+        const unsigned_type rhs_abs = (rhs < 0) ? unsigned_type(0) - static_cast<unsigned_type>(rhs)
+                                                : static_cast<unsigned_type>(rhs);
+        const unsigned_type product = lhs_abs * rhs_abs;
+        res = static_cast<T>(negative ? unsigned_type(0) - product : product);
+        if (lhs_abs == 0 || rhs_abs == 0) {
+            return false;
+        }
+        const unsigned_type bound = static_cast<unsigned_type>(std::numeric_limits<T>::max())
+                                  + (negative ? 1u : 0u);
+        return lhs_abs > bound / rhs_abs;
+    }
+#endif
+
+    template<typename T>
+    constexpr auto mul_overflow(T lhs, T rhs, T& res)
+        -> bool
+    {
+#ifdef STATIC_MATH_HAS_BUILTIN_OVERFLOW
+        return __builtin_mul_overflow(lhs, rhs, &res);
+#else
+        using has_wider = std::integral_constant<
+            bool,
+            !std::is_void<widened_t<T>>::value
+        >;
+        return mul_overflow_helper(has_wider{}, lhs, rhs, res);
+#endif
+    }
+}}
+
+#endif // SMATH_DETAIL_OVERFLOW_H_
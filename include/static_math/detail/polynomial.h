@@ -0,0 +1,102 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_DETAIL_POLYNOMIAL_H_
+#define SMATH_DETAIL_POLYNOMIAL_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+
+namespace smath
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Polynomial coefficients
+
+    // Coefficients are stored from the constant term to the
+    // coefficient of the highest degree
+    template<typename T, std::size_t N>
+    struct polynomial
+    {
+        T coefficients[N];
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Horner scheme
+
+    template<typename T, typename U, std::size_t N>
+    constexpr auto horner(T x, const polynomial<U, N>& poly)
+        -> T
+    {
+        T res = poly.coefficients[N - 1];
+        for (std::size_t i = N - 1 ; i > 0 ; --i) {
+            res = res * x + poly.coefficients[i - 1];
+        }
+        return res;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Estrin scheme
+
+    // Evaluates pairs of coefficients independently and combines
+    // them with increasing powers of x, which shortens dependency
+    // chains compared to the Horner scheme
+    template<typename T, typename U, std::size_t N>
+    constexpr auto estrin(T x, const polynomial<U, N>& poly)
+        -> T
+    {
+        T terms[N] = {};
+        for (std::size_t i = 0 ; i < N ; ++i) {
+            terms[i] = poly.coefficients[i];
+        }
+
+        std::size_t size = N;
+        T power = x;
+        while (size > 1) {
+            for (std::size_t i = 0 ; i < size / 2 ; ++i) {
+                terms[i] = terms[2 * i] + terms[2 * i + 1] * power;
+            }
+            if (size % 2 != 0) {
+                terms[size / 2] = terms[size - 1];
+            }
+            size = (size + 1) / 2;
+            power *= power;
+        }
+        return terms[0];
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Default evaluation scheme
+
+    template<typename T, typename U, std::size_t N>
+    constexpr auto evaluate(T x, const polynomial<U, N>& poly)
+        -> T
+    {
+        return (N > 4) ? detail::estrin(x, poly) : detail::horner(x, poly);
+    }
+}}
+
+#endif // SMATH_DETAIL_POLYNOMIAL_H_
@@ -22,6 +22,269 @@
  * THE SOFTWARE.
  */
 
+////////////////////////////////////////////////////////////
+// Helper functions
+
+namespace detail
+{
+    // Whether the products of the given numerators and denominators
+    // as well as the sum of two such products can't overflow
+    template<typename T>
+    constexpr auto rational_parts_fit(T lhs_numer, T lhs_denom, T rhs_numer, T rhs_denom)
+        -> bool
+    {
+        using unsigned_type = typename gcd_unsigned<T>::type;
+        constexpr int bits = (std::numeric_limits<T>::digits - 1) / 2;
+
+        const unsigned_type magnitudes = unsigned_abs(lhs_numer) | unsigned_abs(lhs_denom)
+                                       | unsigned_abs(rhs_numer) | unsigned_abs(rhs_denom);
+        return magnitudes < (unsigned_type(1) << bits);
+    }
+
+    // Arithmetic policies for the rational operations: the checked
+    // one records whether an operation overflowed
+
+    struct unchecked_arithmetic
+    {
+        template<typename T>
+        static constexpr auto add(T lhs, T rhs, bool&)
+            -> T
+        {
+            return lhs + rhs;
+        }
+
+        template<typename T>
+        static constexpr auto sub(T lhs, T rhs, bool&)
+            -> T
+        {
+            return lhs - rhs;
+        }
+
+        template<typename T>
+        static constexpr auto mul(T lhs, T rhs, bool&)
+            -> T
+        {
+            return lhs * rhs;
+        }
+    };
+
+    struct checked_arithmetic
+    {
+        template<typename T>
+        static constexpr auto add(T lhs, T rhs, bool& overflow)
+            -> T
+        {
+            T res = 0;
+            overflow |= add_overflow(lhs, rhs, res);
+            return res;
+        }
+
+        template<typename T>
+        static constexpr auto sub(T lhs, T rhs, bool& overflow)
+            -> T
+        {
+            T res = 0;
+            overflow |= sub_overflow(lhs, rhs, res);
+            return res;
+        }
+
+        template<typename T>
+        static constexpr auto mul(T lhs, T rhs, bool& overflow)
+            -> T
+        {
+            T res = 0;
+            overflow |= mul_overflow(lhs, rhs, res);
+            return res;
+        }
+    };
+
+    // gcd of a numerator or denominator and a denominator, the
+    // denominator of an integer converted to rational is 1
+    template<typename T>
+    constexpr auto rational_gcd(T a, T b)
+        -> T
+    {
+        return (a == 1 || b == 1) ? T(1) : smath::gcd(a, b);
+    }
+
+    template<typename T, typename U>
+    constexpr auto rational_cast(rational<U> ratio)
+        -> rational<T>
+    {
+        return { reduced, static_cast<T>(ratio.numer), static_cast<T>(ratio.denom) };
+    }
+
+    // The following operations implement Knuth's algorithms from
+    // The Art of Computer Programming, 4.5.1: the operands are
+    // divided by the gcd of a numerator and a denominator or of
+    // both denominators before being multiplied, which keeps the
+    // intermediate values small, and the result doesn't have to be
+    // simplified since the operands already are
+
+    template<typename Arithmetic, typename T>
+    constexpr auto rational_add(Arithmetic, rational<T> lhs, rational<T> rhs, bool subtract)
+        -> checked_rational<T>
+    {
+        bool overflow = false;
+        const T divisor = rational_gcd(lhs.denom, rhs.denom);
+        if (divisor == 1) {
+            const T lhs_part = Arithmetic::mul(lhs.numer, rhs.denom, overflow);
+            const T rhs_part = Arithmetic::mul(rhs.numer, lhs.denom, overflow);
+            const T numer = subtract ? Arithmetic::sub(lhs_part, rhs_part, overflow)
+                                     : Arithmetic::add(lhs_part, rhs_part, overflow);
+            const T denom = Arithmetic::mul(lhs.denom, rhs.denom, overflow);
+            return { rational<T>(reduced, numer, denom), overflow };
+        }
+
+        const T lhs_factor = rhs.denom / divisor;
+        const T rhs_factor = lhs.denom / divisor;
+        const T lhs_part = Arithmetic::mul(lhs.numer, lhs_factor, overflow);
+        const T rhs_part = Arithmetic::mul(rhs.numer, rhs_factor, overflow);
+        const T numer = subtract ? Arithmetic::sub(lhs_part, rhs_part, overflow)
+                                 : Arithmetic::add(lhs_part, rhs_part, overflow);
+        if (numer == 0) {
+            return { rational<T>(0), overflow };
+        }
+        // Only the factors common to the numerator and to the gcd
+        // of the denominators are left to remove
+        const T numer_divisor = smath::gcd(numer, divisor);
+        const T denom = Arithmetic::mul(rhs_factor, rhs.denom / numer_divisor, overflow);
+        return { rational<T>(reduced, numer / numer_divisor, denom), overflow };
+    }
+
+    template<typename Arithmetic, typename T>
+    constexpr auto rational_mul(Arithmetic, rational<T> lhs, rational<T> rhs)
+        -> checked_rational<T>
+    {
+        bool overflow = false;
+        if (rational_parts_fit(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            // The products can't overflow, simplifying them once is
+            // cheaper than computing two gcds
+            return { rational<T>(lhs.numer * rhs.numer, lhs.denom * rhs.denom), overflow };
+        }
+        if (lhs.numer == 0 || rhs.numer == 0) {
+            return { rational<T>(0), overflow };
+        }
+        const T lhs_divisor = rational_gcd(lhs.numer, rhs.denom);
+        const T rhs_divisor = rational_gcd(rhs.numer, lhs.denom);
+        const T numer = Arithmetic::mul(lhs.numer / lhs_divisor, rhs.numer / rhs_divisor, overflow);
+        const T denom = Arithmetic::mul(lhs.denom / rhs_divisor, rhs.denom / lhs_divisor, overflow);
+        return { rational<T>(reduced, numer, denom), overflow };
+    }
+
+    template<typename Arithmetic, typename T>
+    constexpr auto rational_div(Arithmetic, rational<T> lhs, rational<T> rhs)
+        -> checked_rational<T>
+    {
+        bool overflow = false;
+        if (rational_parts_fit(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            return { rational<T>(lhs.numer * rhs.denom, lhs.denom * rhs.numer), overflow };
+        }
+        if (lhs.numer == 0) {
+            return { rational<T>(0), overflow };
+        }
+        const T numer_divisor = rational_gcd(lhs.numer, rhs.numer);
+        const T denom_divisor = rational_gcd(lhs.denom, rhs.denom);
+        T numer = Arithmetic::mul(lhs.numer / numer_divisor, rhs.denom / denom_divisor, overflow);
+        T denom = Arithmetic::mul(lhs.denom / denom_divisor, rhs.numer / numer_divisor, overflow);
+        if (denom < 0) {
+            numer = Arithmetic::sub(T(0), numer, overflow);
+            denom = Arithmetic::sub(T(0), denom, overflow);
+        }
+        return { rational<T>(reduced, numer, denom), overflow };
+    }
+
+    // Simplified lazy rationals whose parts are still too large for
+    // the lazy operations to multiply them safely are handled by the
+    // algorithms above
+    template<typename T, typename U>
+    constexpr auto lazy_cast(lazy_rational<U> ratio)
+        -> rational<T>
+    {
+        return { reduced, static_cast<T>(ratio.numer), static_cast<T>(ratio.denom) };
+    }
+
+    // Sign of a/b - c/d for non-negative numerators and positive
+    // denominators, computed by comparing the continued fraction
+    // expansions of both fractions, which can't overflow
+    template<typename Unsigned>
+    constexpr auto compare_magnitudes(Unsigned a, Unsigned b, Unsigned c, Unsigned d)
+        -> int
+    {
+        while (true) {
+            const Unsigned a_quotient = a / b;
+            const Unsigned c_quotient = c / d;
+            if (a_quotient != c_quotient) {
+                return (a_quotient < c_quotient) ? -1 : 1;
+            }
+            const Unsigned a_remainder = a % b;
+            const Unsigned c_remainder = c % d;
+            if (a_remainder == 0 || c_remainder == 0) {
+                return (a_remainder == c_remainder) ? 0 : (a_remainder == 0) ? -1 : 1;
+            }
+            // a_remainder/b < c_remainder/d if and only if
+            // d/c_remainder < b/a_remainder
+            a = d;
+            d = a_remainder;
+            c = b;
+            b = c_remainder;
+        }
+    }
+
+    // Sign of the difference of two fractions with positive
+    // denominators whose cross products could overflow T: they are
+    // computed in a wider type when there is one
+
+    template<typename T>
+    constexpr auto compare_large_fractions(std::true_type, T lhs_numer, T lhs_denom, T rhs_numer, T rhs_denom)
+        -> int
+    {
+        using wide_type = widened_t<T>;
+        const wide_type lhs = static_cast<wide_type>(lhs_numer) * static_cast<wide_type>(rhs_denom);
+        const wide_type rhs = static_cast<wide_type>(rhs_numer) * static_cast<wide_type>(lhs_denom);
+        return (lhs < rhs) ? -1 : (rhs < lhs) ? 1 : 0;
+    }
+
+    template<typename T>
+    constexpr auto compare_large_fractions(std::false_type, T lhs_numer, T lhs_denom, T rhs_numer, T rhs_denom)
+        -> int
+    {
+        using unsigned_type = typename gcd_unsigned<T>::type;
+        if ((lhs_numer < 0) != (rhs_numer < 0)) {
+            return (lhs_numer < 0) ? -1 : 1;
+        }
+        const int res = compare_magnitudes(unsigned_abs(lhs_numer), static_cast<unsigned_type>(lhs_denom),
+                                           unsigned_abs(rhs_numer), static_cast<unsigned_type>(rhs_denom));
+        return (lhs_numer < 0) ? -res : res;
+    }
+
+    // Sign of the difference of two lazy rationals: the fractions
+    // are compared through their cross products, which is valid
+    // since the denominators are positive
+    template<typename T, typename U>
+    constexpr auto lazy_compare(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> int
+    {
+        using common_type = std::common_type_t<T, U>;
+        if (!rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            lhs.normalize();
+            rhs.normalize();
+            if (!rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+                using has_wider_type = std::integral_constant<
+                    bool,
+                    !std::is_void<widened_t<common_type>>::value
+                >;
+                return compare_large_fractions<common_type>(has_wider_type{},
+                    lhs.numer, lhs.denom, rhs.numer, rhs.denom
+                );
+            }
+        }
+        const common_type lhs_product = static_cast<common_type>(lhs.numer) * static_cast<common_type>(rhs.denom);
+        const common_type rhs_product = static_cast<common_type>(rhs.numer) * static_cast<common_type>(lhs.denom);
+        return (lhs_product < rhs_product) ? -1 : (rhs_product < lhs_product) ? 1 : 0;
+    }
+}
+
 ////////////////////////////////////////////////////////////
 // Construction
 
@@ -33,16 +296,26 @@ constexpr rational<T>::rational(value_type numerator):
 
 template<typename T>
 constexpr rational<T>::rational(value_type numerator, value_type denominator):
+    rational(numerator, denominator, gcd(numerator, denominator))
+{}
+
+template<typename T>
+constexpr rational<T>::rational(detail::reduced_t, value_type numerator, value_type denominator):
+    numer(numerator),
+    denom(denominator)
+{}
+
+template<typename T>
+constexpr rational<T>::rational(value_type numerator, value_type denominator,
+                                value_type divisor):
     numer(
         numerator != 0 ?
-            numerator * sign(denominator)
-                / gcd(abs(numerator), abs(denominator))
+            numerator * sign(denominator) / divisor
         : 0
     ),
     denom(
         numerator != 0 ?
-            abs(denominator)
-                / gcd(abs(numerator), abs(denominator))
+            abs(denominator) / divisor
         : 1
     )
 {}
@@ -92,6 +365,7 @@ constexpr auto operator-(rational<T> lhs)
     -> rational<T>
 {
     return {
+        detail::reduced,
         -lhs.numer,
         lhs.denom
     };
@@ -104,120 +378,182 @@ template<typename T, typename U>
 constexpr auto operator+(rational<T> lhs, rational<U> rhs)
     -> rational<std::common_type_t<T, U>>
 {
-    return {
-        lhs.numer * rhs.denom + rhs.numer * lhs.denom,
-        lhs.denom * rhs.denom
-    };
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_add(detail::unchecked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs), false
+    ).value;
 }
 
 template<typename T, typename U>
 constexpr auto operator-(rational<T> lhs, rational<U> rhs)
     -> rational<std::common_type_t<T, U>>
 {
-    return {
-        lhs.numer * rhs.denom - rhs.numer * lhs.denom,
-        lhs.denom * rhs.denom
-    };
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_add(detail::unchecked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs), true
+    ).value;
 }
 
 template<typename T, typename U>
 constexpr auto operator*(rational<T> lhs, rational<U> rhs)
     -> rational<std::common_type_t<T, U>>
 {
-    return {
-        lhs.numer * rhs.numer,
-        lhs.denom * rhs.denom
-    };
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_mul(detail::unchecked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs)
+    ).value;
 }
 
 template<typename T, typename U>
 constexpr auto operator/(rational<T> lhs, rational<U> rhs)
     -> rational<std::common_type_t<T, U>>
 {
-    return {
-        lhs.numer * rhs.denom,
-        lhs.denom * rhs.numer
-    };
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_div(detail::unchecked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs)
+    ).value;
 }
 
 template<typename T, typename Integer>
 constexpr auto operator+(rational<T> lhs, Integer rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs.numer + rhs * lhs.denom,
-        lhs.denom
-    };
+    return lhs + rational<Integer>(rhs);
 }
 
 template<typename T, typename Integer>
 constexpr auto operator-(rational<T> lhs, Integer rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs.numer - rhs * lhs.denom,
-        lhs.denom
-    };
+    return lhs - rational<Integer>(rhs);
 }
 
 template<typename T, typename Integer>
 constexpr auto operator*(rational<T> lhs, Integer rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs.numer * rhs,
-        lhs.denom
-    };
+    return lhs * rational<Integer>(rhs);
 }
 
 template<typename T, typename Integer>
 constexpr auto operator/(rational<T> lhs, Integer rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs.numer,
-        lhs.denom * rhs
-    };
+    return lhs / rational<Integer>(rhs);
 }
 
 template<typename T, typename Integer>
 constexpr auto operator+(Integer lhs, rational<T> rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs * rhs.denom + rhs.numer,
-        rhs.denom
-    };
+    return rational<Integer>(lhs) + rhs;
 }
 
 template<typename T, typename Integer>
 constexpr auto operator-(Integer lhs, rational<T> rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs * rhs.denom - rhs.numer,
-        rhs.denom
-    };
+    return rational<Integer>(lhs) - rhs;
 }
 
 template<typename T, typename Integer>
 constexpr auto operator*(Integer lhs, rational<T> rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs * rhs.numer,
-        rhs.denom
-    };
+    return rational<Integer>(lhs) * rhs;
 }
 
 template<typename T, typename Integer>
 constexpr auto operator/(Integer lhs, rational<T> rhs)
     -> rational<std::common_type_t<T, Integer>>
 {
-    return {
-        lhs * rhs.denom,
-        rhs.numer
-    };
+    return rational<Integer>(lhs) / rhs;
+}
+
+////////////////////////////////////////////////////////////
+// Overflow-checked arithmetic operations
+
+template<typename T, typename U>
+constexpr auto checked_add(rational<T> lhs, rational<U> rhs)
+    -> checked_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_add(detail::checked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs), false
+    );
+}
+
+template<typename T, typename U>
+constexpr auto checked_sub(rational<T> lhs, rational<U> rhs)
+    -> checked_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_add(detail::checked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs), true
+    );
+}
+
+template<typename T, typename U>
+constexpr auto checked_mul(rational<T> lhs, rational<U> rhs)
+    -> checked_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_mul(detail::checked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs)
+    );
+}
+
+template<typename T, typename U>
+constexpr auto checked_div(rational<T> lhs, rational<U> rhs)
+    -> checked_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    return detail::rational_div(detail::checked_arithmetic{},
+        detail::rational_cast<common_type>(lhs), detail::rational_cast<common_type>(rhs)
+    );
+}
+
+////////////////////////////////////////////////////////////
+// Widening arithmetic operations
+
+template<typename T, typename U>
+constexpr auto widening_add(rational<T> lhs, rational<U> rhs)
+    -> detail::apply_widened_t<rational, std::common_type_t<T, U>>
+{
+    using wide_type = detail::widened_t<std::common_type_t<T, U>>;
+    return detail::rational_add(detail::unchecked_arithmetic{},
+        detail::rational_cast<wide_type>(lhs), detail::rational_cast<wide_type>(rhs), false
+    ).value;
+}
+
+template<typename T, typename U>
+constexpr auto widening_sub(rational<T> lhs, rational<U> rhs)
+    -> detail::apply_widened_t<rational, std::common_type_t<T, U>>
+{
+    using wide_type = detail::widened_t<std::common_type_t<T, U>>;
+    return detail::rational_add(detail::unchecked_arithmetic{},
+        detail::rational_cast<wide_type>(lhs), detail::rational_cast<wide_type>(rhs), true
+    ).value;
+}
+
+template<typename T, typename U>
+constexpr auto widening_mul(rational<T> lhs, rational<U> rhs)
+    -> detail::apply_widened_t<rational, std::common_type_t<T, U>>
+{
+    using wide_type = detail::widened_t<std::common_type_t<T, U>>;
+    return detail::rational_mul(detail::unchecked_arithmetic{},
+        detail::rational_cast<wide_type>(lhs), detail::rational_cast<wide_type>(rhs)
+    ).value;
+}
+
+template<typename T, typename U>
+constexpr auto widening_div(rational<T> lhs, rational<U> rhs)
+    -> detail::apply_widened_t<rational, std::common_type_t<T, U>>
+{
+    using wide_type = detail::widened_t<std::common_type_t<T, U>>;
+    return detail::rational_div(detail::unchecked_arithmetic{},
+        detail::rational_cast<wide_type>(lhs), detail::rational_cast<wide_type>(rhs)
+    ).value;
 }
 
 ////////////////////////////////////////////////////////////
@@ -399,7 +735,8 @@ template<typename T>
 constexpr auto reciprocal(rational<T> ratio)
     -> rational<T>
 {
-    return { ratio.denom, ratio.numer };
+    return (ratio.numer < 0) ? rational<T>(detail::reduced, -ratio.denom, -ratio.numer)
+                             : rational<T>(detail::reduced, ratio.denom, ratio.numer);
 }
 
 template<typename T, typename Integer>
@@ -420,6 +757,435 @@ constexpr auto pow(rational<T> ratio, Integer exp)
                     );
 }
 
+////////////////////////////////////////////////////////////
+// Lazy rational construction
+
+template<typename T>
+constexpr lazy_rational<T>::lazy_rational(value_type numerator):
+    numer(numerator),
+    denom(1)
+{}
+
+template<typename T>
+constexpr lazy_rational<T>::lazy_rational(value_type numerator, value_type denominator):
+    numer(denominator < 0 ? -numerator : numerator),
+    denom(abs(denominator))
+{}
+
+template<typename T>
+constexpr lazy_rational<T>::lazy_rational(rational<value_type> ratio):
+    numer(ratio.numer),
+    denom(ratio.denom)
+{}
+
+////////////////////////////////////////////////////////////
+// Lazy rational normalization
+
+template<typename T>
+constexpr auto lazy_rational<T>::normalize()
+    -> lazy_rational&
+{
+    // smath::gcd returns 0 as soon as one of its arguments is 0,
+    // and the denominator never is, so only a zero numerator gets
+    // there; the fraction is then 0/1
+    const value_type divisor = gcd(numer, denom);
+    if (divisor == 0) {
+        denom = 1;
+    } else {
+        numer /= divisor;
+        denom /= divisor;
+    }
+    return *this;
+}
+
+////////////////////////////////////////////////////////////
+// Lazy rational compound assignment operators
+
+template<typename T>
+constexpr auto lazy_rational<T>::operator+=(lazy_rational other)
+    -> lazy_rational&
+{
+    return *this = *this + other;
+}
+
+template<typename T>
+constexpr auto lazy_rational<T>::operator-=(lazy_rational other)
+    -> lazy_rational&
+{
+    return *this = *this - other;
+}
+
+template<typename T>
+constexpr auto lazy_rational<T>::operator*=(lazy_rational other)
+    -> lazy_rational&
+{
+    return *this = *this * other;
+}
+
+template<typename T>
+constexpr auto lazy_rational<T>::operator/=(lazy_rational other)
+    -> lazy_rational&
+{
+    return *this = *this / other;
+}
+
+////////////////////////////////////////////////////////////
+// Lazy rational casts
+
+template<typename T>
+constexpr lazy_rational<T>::operator rational<value_type>() const
+{
+    return { numer, denom };
+}
+
+template<typename T>
+constexpr lazy_rational<T>::operator float() const
+{
+    return static_cast<float>(rational<value_type>(*this));
+}
+
+template<typename T>
+constexpr lazy_rational<T>::operator double() const
+{
+    return static_cast<double>(rational<value_type>(*this));
+}
+
+template<typename T>
+constexpr lazy_rational<T>::operator long double() const
+{
+    return static_cast<long double>(rational<value_type>(*this));
+}
+
+template<typename T>
+constexpr lazy_rational<T>::operator bool() const
+{
+    return numer != 0;
+}
+
+////////////////////////////////////////////////////////////
+// Lazy rational unary arithmetic operators
+
+template<typename T>
+constexpr auto operator+(lazy_rational<T> lhs)
+    -> lazy_rational<T>
+{
+    return lhs;
+}
+
+template<typename T>
+constexpr auto operator-(lazy_rational<T> lhs)
+    -> lazy_rational<T>
+{
+    return {
+        -lhs.numer,
+        lhs.denom
+    };
+}
+
+////////////////////////////////////////////////////////////
+// Lazy rational binary arithmetic operators
+
+template<typename T, typename U>
+constexpr auto operator+(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> lazy_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+        lhs.normalize();
+        rhs.normalize();
+        if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            return detail::rational_add(detail::unchecked_arithmetic{},
+                detail::lazy_cast<common_type>(lhs), detail::lazy_cast<common_type>(rhs), false
+            ).value;
+        }
+    }
+    if (lhs.denom == rhs.denom) {
+        return {
+            lhs.numer + rhs.numer,
+            lhs.denom
+        };
+    }
+    return {
+        lhs.numer * rhs.denom + rhs.numer * lhs.denom,
+        lhs.denom * rhs.denom
+    };
+}
+
+template<typename T, typename U>
+constexpr auto operator-(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> lazy_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+        lhs.normalize();
+        rhs.normalize();
+        if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            return detail::rational_add(detail::unchecked_arithmetic{},
+                detail::lazy_cast<common_type>(lhs), detail::lazy_cast<common_type>(rhs), true
+            ).value;
+        }
+    }
+    if (lhs.denom == rhs.denom) {
+        return {
+            lhs.numer - rhs.numer,
+            lhs.denom
+        };
+    }
+    return {
+        lhs.numer * rhs.denom - rhs.numer * lhs.denom,
+        lhs.denom * rhs.denom
+    };
+}
+
+template<typename T, typename U>
+constexpr auto operator*(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> lazy_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+        lhs.normalize();
+        rhs.normalize();
+        if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            return detail::rational_mul(detail::unchecked_arithmetic{},
+                detail::lazy_cast<common_type>(lhs), detail::lazy_cast<common_type>(rhs)
+            ).value;
+        }
+    }
+    return {
+        lhs.numer * rhs.numer,
+        lhs.denom * rhs.denom
+    };
+}
+
+template<typename T, typename U>
+constexpr auto operator/(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> lazy_rational<std::common_type_t<T, U>>
+{
+    using common_type = std::common_type_t<T, U>;
+    if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+        lhs.normalize();
+        rhs.normalize();
+        if (!detail::rational_parts_fit<common_type>(lhs.numer, lhs.denom, rhs.numer, rhs.denom)) {
+            return detail::rational_div(detail::unchecked_arithmetic{},
+                detail::lazy_cast<common_type>(lhs), detail::lazy_cast<common_type>(rhs)
+            ).value;
+        }
+    }
+    return {
+        lhs.numer * rhs.denom,
+        lhs.denom * rhs.numer
+    };
+}
+
+template<typename T, typename Integer>
+constexpr auto operator+(lazy_rational<T> lhs, Integer rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lhs + lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator-(lazy_rational<T> lhs, Integer rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lhs - lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator*(lazy_rational<T> lhs, Integer rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lhs * lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator/(lazy_rational<T> lhs, Integer rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lhs / lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator+(Integer lhs, lazy_rational<T> rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lazy_rational<Integer>(lhs) + rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator-(Integer lhs, lazy_rational<T> rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lazy_rational<Integer>(lhs) - rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator*(Integer lhs, lazy_rational<T> rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lazy_rational<Integer>(lhs) * rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator/(Integer lhs, lazy_rational<T> rhs)
+    -> lazy_rational<std::common_type_t<T, Integer>>
+{
+    return lazy_rational<Integer>(lhs) / rhs;
+}
+
+////////////////////////////////////////////////////////////
+// Lazy rational relational operators
+
+template<typename T, typename U>
+constexpr auto operator==(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> bool
+{
+    return detail::lazy_compare(lhs, rhs) == 0;
+}
+
+template<typename T, typename U>
+constexpr auto operator!=(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> bool
+{
+    return !(lhs == rhs);
+}
+
+template<typename T, typename U>
+constexpr auto operator<(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> bool
+{
+    return detail::lazy_compare(lhs, rhs) < 0;
+}
+
+template<typename T, typename U>
+constexpr auto operator>(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> bool
+{
+    return rhs < lhs;
+}
+
+template<typename T, typename U>
+constexpr auto operator<=(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> bool
+{
+    return !(rhs < lhs);
+}
+
+template<typename T, typename U>
+constexpr auto operator>=(lazy_rational<T> lhs, lazy_rational<U> rhs)
+    -> bool
+{
+    return !(lhs < rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator==(lazy_rational<T> lhs, Integer rhs)
+    -> bool
+{
+    return lhs == lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator!=(lazy_rational<T> lhs, Integer rhs)
+    -> bool
+{
+    return lhs != lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator<(lazy_rational<T> lhs, Integer rhs)
+    -> bool
+{
+    return lhs < lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator>(lazy_rational<T> lhs, Integer rhs)
+    -> bool
+{
+    return lhs > lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator<=(lazy_rational<T> lhs, Integer rhs)
+    -> bool
+{
+    return lhs <= lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator>=(lazy_rational<T> lhs, Integer rhs)
+    -> bool
+{
+    return lhs >= lazy_rational<Integer>(rhs);
+}
+
+template<typename T, typename Integer>
+constexpr auto operator==(Integer lhs, lazy_rational<T> rhs)
+    -> bool
+{
+    return lazy_rational<Integer>(lhs) == rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator!=(Integer lhs, lazy_rational<T> rhs)
+    -> bool
+{
+    return lazy_rational<Integer>(lhs) != rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator<(Integer lhs, lazy_rational<T> rhs)
+    -> bool
+{
+    return lazy_rational<Integer>(lhs) < rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator>(Integer lhs, lazy_rational<T> rhs)
+    -> bool
+{
+    return lazy_rational<Integer>(lhs) > rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator<=(Integer lhs, lazy_rational<T> rhs)
+    -> bool
+{
+    return lazy_rational<Integer>(lhs) <= rhs;
+}
+
+template<typename T, typename Integer>
+constexpr auto operator>=(Integer lhs, lazy_rational<T> rhs)
+    -> bool
+{
+    return lazy_rational<Integer>(lhs) >= rhs;
+}
+
+////////////////////////////////////////////////////////////
+// Lazy rational mathematical functions
+
+template<typename T>
+constexpr auto sign(lazy_rational<T> ratio)
+    -> int
+{
+    return (ratio.numer > 0) ? 1 : (ratio.numer < 0) ? -1 : 0;
+}
+
+template<typename T>
+constexpr auto abs(lazy_rational<T> ratio)
+    -> lazy_rational<T>
+{
+    return (ratio.numer < 0) ? -ratio : ratio;
+}
+
+template<typename T>
+constexpr auto reciprocal(lazy_rational<T> ratio)
+    -> lazy_rational<T>
+{
+    return { ratio.denom, ratio.numer };
+}
+
 inline namespace literals
 {
 inline namespace rational_literals
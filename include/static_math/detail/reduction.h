@@ -0,0 +1,569 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_DETAIL_REDUCTION_H_
+#define SMATH_DETAIL_REDUCTION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "floating_point.h"
+
+// This header contains the constants and algorithms used to reduce
+// the arguments of the mathematical functions to the small ranges
+// where their kernels are accurate. Most notably, it contains the
+// reduction of an angle to the range [-pi/4, pi/4] used by the
+// trigonometric functions: the Cody-Waite reduction is used for small
+// and medium arguments, and the Payne-Hanek reduction for large
+// arguments or when the Cody-Waite reduction suffers from too much
+// cancellation
+
+namespace smath
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Type in which the reduction is performed
+
+    // Types with less precision than double are reduced as double
+    template<typename T>
+    using reduction_t = std::conditional_t<
+        (std::numeric_limits<T>::digits < std::numeric_limits<double>::digits),
+        double,
+        T
+    >;
+
+    ////////////////////////////////////////////////////////////
+    // Splits of ln(2)
+
+    // hi has its 20 lowest bits cleared so that k * hi is exact
+    // for |k| < 2^20, hi + lo is ln(2)
+    template<int Digits>
+    struct ln2_split;
+
+    template<>
+    struct ln2_split<53>
+    {
+        static constexpr double hi = 6.93147180485539138317108154296875e-01;
+        static constexpr double lo = 7.44061711001239684737714098540257036e-11;
+    };
+
+    template<>
+    struct ln2_split<64>
+    {
+        static constexpr long double hi = 6.93147180559890330187045037746429443e-01L;
+        static constexpr long double lo = 5.49792301870837117465539452812927391e-14L;
+    };
+
+    template<>
+    struct ln2_split<113>
+    {
+        static constexpr long double hi = 6.9314718055994530941723212145798186357e-01L;
+        static constexpr long double lo = 1.9470450923807499515879595733332737861e-31L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Splits of pi/2
+
+    // c1 and c2 have their 20 lowest bits cleared so that k * c1
+    // and k * c2 are exact for |k| < 2^20, c1 + c2 + c3 is pi/2;
+    // hi + lo is pi/2 with twice the precision of the type
+    template<int Digits>
+    struct pio2_split;
+
+    template<>
+    struct pio2_split<53>
+    {
+        static constexpr double c1 = 1.57079632673412561416625976562500000e+00;
+        static constexpr double c2 = 6.07710050630396597659554913661850151e-11;
+        static constexpr double c3 = 2.02226624879595063154114426136992698e-21;
+        static constexpr double hi = 1.57079632679489655799898173427209258e+00;
+        static constexpr double lo = 6.12323399573676603586882014729198302e-17;
+    };
+
+    template<>
+    struct pio2_split<64>
+    {
+        static constexpr long double c1 = 1.57079632679483438550960272550582886e+00L;
+        static constexpr long double c2 = 6.22337217189626123627194935093113332e-14L;
+        static constexpr long double c3 = 3.52155986518320038834270840770768719e-27L;
+        static constexpr long double hi = 1.57079632679489661925640447970309310e+00L;
+        static constexpr long double lo = -2.50827880633416601172587880019563182e-20L;
+    };
+
+    template<>
+    struct pio2_split<113>
+    {
+        static constexpr long double c1 = 1.5707963267948966192313216915513142364372e+00L;
+        static constexpr long double c2 = 8.8437205661357011202553186319991010791849e-29L;
+        static constexpr long double c3 = 6.3749139503259248082884056540924192172143e-57L;
+        static constexpr long double hi = 1.5707963267948966192313216916397513987395e+00L;
+        static constexpr long double lo = 4.3359050650618905123985220130216761270527e-35L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Splits of atan(1/2) and atan(3/2)
+
+    // hi + lo is the arctangent with twice the precision of the
+    // type; these are the base values of the reduction of atan
+    template<int Digits>
+    struct atan_split;
+
+    template<>
+    struct atan_split<53>
+    {
+        static constexpr double half_hi = 4.63647609000806093515478778499527834e-01;
+        static constexpr double half_lo = 2.26987774529616870924083441919624106e-17;
+        static constexpr double three_halves_hi = 9.82793723247329054082399579783668742e-01;
+        static constexpr double three_halves_lo = 1.39033110312309984515998633820766532e-17;
+    };
+
+    template<>
+    struct atan_split<64>
+    {
+        static constexpr long double half_hi = 4.63647609000806116202409237758708116e-01L;
+        static constexpr long double half_lo = 1.18469937025062860668589144745841915e-20L;
+        static constexpr long double three_halves_hi = 9.82793723247329067960187387598125497e-01L;
+        static constexpr long double three_halves_lo = 2.55232234165405176171801782328529128e-20L;
+    };
+
+    template<>
+    struct atan_split<113>
+    {
+        static constexpr long double half_hi = 4.6364760900080611621425623146121439713e-01L;
+        static constexpr long double half_lo = 4.8950964225733349266861843522029770568e-36L;
+        static constexpr long double three_halves_hi = 9.8279372324732906798571061101466603763e-01L;
+        static constexpr long double three_halves_lo = -2.3128843453818356590931995209806627233e-35L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Splits of log2(e)
+
+    // hi holds half of the bits of the type so that its product with
+    // the high part of a Veltkamp split is exact, hi + lo is log2(e)
+    template<int Digits>
+    struct log2e_split;
+
+    template<>
+    struct log2e_split<53>
+    {
+        static constexpr double hi = 1.44269502162933349609375000000000000e+00;
+        static constexpr double lo = 1.92596299112661746886655659595499746e-08;
+    };
+
+    template<>
+    struct log2e_split<64>
+    {
+        static constexpr long double hi = 1.44269504072144627571105957031250000e+00L;
+        static constexpr long double lo = 1.67517131648865110691648848043507897e-10L;
+    };
+
+    template<>
+    struct log2e_split<113>
+    {
+        static constexpr long double hi = 1.4426950408889633870046509400708600879e+00L;
+        static constexpr long double lo = 2.0355273740931032049555094440481111407e-17L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Splits of log10(2)
+
+    // hi + lo is log10(2) with twice the precision of the type
+    template<int Digits>
+    struct log10_2_split;
+
+    template<>
+    struct log10_2_split<53>
+    {
+        static constexpr double hi = 3.01029995663981198017467022509663366e-01;
+        static constexpr double lo = -2.80372812778517039373260136214326627e-18;
+    };
+
+    template<>
+    struct log10_2_split<64>
+    {
+        static constexpr long double hi = 3.01029995663981195225646428359489448e-01L;
+        static constexpr long double lo = -1.19075336349964214441483691256828685e-20L;
+    };
+
+    template<>
+    struct log10_2_split<113>
+    {
+        static constexpr long double hi = 3.0102999566398119521373889472449302020e-01L;
+        static constexpr long double lo = 6.5712354134654941112801867721555577673e-36L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Splits of log2(10)
+
+    // hi + lo is log2(10) with twice the precision of the type
+    template<int Digits>
+    struct log2_10_split;
+
+    template<>
+    struct log2_10_split<53>
+    {
+        static constexpr double hi = 3.32192809488736218170856773213017732e+00;
+        static constexpr double lo = 1.66161751697359200641302817729765062e-16;
+    };
+
+    template<>
+    struct log2_10_split<64>
+    {
+        static constexpr long double hi = 3.32192809488736234780834055690945661e+00L;
+        static constexpr long double lo = 6.19788725799335668749984550455397682e-20L;
+    };
+
+    template<>
+    struct log2_10_split<113>
+    {
+        static constexpr long double hi = 3.3219280948873623478703194294893902863e+00L;
+        static constexpr long double lo = -1.1043946562012806572027913728644266896e-34L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Splits of log(2 pi)/2
+
+    // hi + lo is log(2 pi)/2 with twice the precision of the type,
+    // the constant term of the Stirling series of lgamma
+    template<int Digits>
+    struct half_log_2pi_split;
+
+    template<>
+    struct half_log_2pi_split<53>
+    {
+        static constexpr double hi = 9.18938533204672780563271317078033462e-01;
+        static constexpr double lo = -3.87829415806724144983337918704029508e-17;
+    };
+
+    template<>
+    struct half_log_2pi_split<64>
+    {
+        static constexpr long double hi = 9.18938533204672741803043650721249946e-01L;
+        static constexpr long double lo = -2.27139143156323065383965139531777083e-20L;
+    };
+
+    template<>
+    struct half_log_2pi_split<113>
+    {
+        static constexpr long double hi = 9.1893853320467274178032973640561761568e-01L;
+        static constexpr long double lo = 2.4179364221258175093501810414309613012e-35L;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Binary expansion of 2/pi
+
+    // Enough bits to reduce any finite number whose exponent
+    // is lesser than 2^14, which covers all common types
+    constexpr std::uint32_t two_over_pi_bits[] = {
+        0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041,
+        0xFE5163AB, 0xDEBBC561, 0xB7246E3A, 0x424DD2E0, 0x06492EEA, 0x09D1921C,
+        0xFE1DEB1C, 0xB129A73E, 0xE88235F5, 0x2EBB4484, 0xE99C7026, 0xB45F7E41,
+        0x3991D639, 0x835339F4, 0x9C845F8B, 0xBDF9283B, 0x1FF897FF, 0xDE05980F,
+        0xEF2F118B, 0x5A0A6D1F, 0x6D367ECF, 0x27CB09B7, 0x4F463F66, 0x9E5FEA2D,
+        0x7527BAC7, 0xEBE5F17B, 0x3D0739F7, 0x8A5292EA, 0x6BFB5FB1, 0x1F8D5D08,
+        0x56033046, 0xFC7B6BAB, 0xF0CFBC20, 0x9AF4361D, 0xA9E39161, 0x5EE61B08,
+        0x6599855F, 0x14A06840, 0x8DFFD880, 0x4D732731, 0x06061556, 0xCA73A8C9,
+        0x60E27BC0, 0x8C6B47C4, 0x19C367CD, 0xDCE8092A, 0x8359C476, 0x8B961CA6,
+        0xDDAF44D1, 0x5719053E, 0xA5FF0705, 0x3F7E33E8, 0x32C2DE4F, 0x98327DBB,
+        0xC33D26EF, 0x6B1E5EF8, 0x9F3A1F35, 0xCAF27F1D, 0x87F12190, 0x7C7C246A,
+        0xFA6ED577, 0x2D30433B, 0x15C614B5, 0x9D19C3C2, 0xC4AD414D, 0x2C5D000C,
+        0x467D862D, 0x71E39AC6, 0x9B006233, 0x7CD2B497, 0xA7B4D555, 0x37F63ED7,
+        0x1810A3FC, 0x764D2A9D, 0x64ABD770, 0xF87C6357, 0xB07AE715, 0x175649C0,
+        0xD9D63B38, 0x84A7CB23, 0x24778AD6, 0x23545AB9, 0x1F001B0A, 0xF1DFCE19,
+        0xFF319F6A, 0x1E666157, 0x9947FBAC, 0xD87F7EB7, 0x652289E8, 0x3260BFE6,
+        0xCDC4EF09, 0x366CD43F, 0x5DD7DE16, 0xDE3B5892, 0x9BDE2822, 0xD2E88628,
+        0x4D58E232, 0xCAC616E3, 0x08CB7DE0, 0x50C017A7, 0x1DF35BE0, 0x1834132E,
+        0x62128301, 0x48835B8E, 0xF57FB0AD, 0xF2E91E43, 0x4A48D367, 0x10D8DDAA,
+        0x425FAECE, 0x616AA428, 0x0AB499D3, 0xF2A6067F, 0x775C83C2, 0xA3883C61,
+        0x78738A5A, 0x8CAFBDD7, 0x6F63A62D, 0xCBBFF4EF, 0x818D67C1, 0x2645CA55,
+        0x36D9CAD2, 0xA8288D61, 0xC277C912, 0x1426049B, 0x4612C459, 0xC444C5C8,
+        0x91B24DF3, 0x1700AD43, 0xD4E54929, 0x10D5FDFC, 0xBE00CC94, 0x1EEECE70,
+        0xF53E1380, 0xF1ECC3E7, 0xB328F8C7, 0x9405933E, 0x71C1B309, 0x2EF3450B,
+        0x9C12887B, 0x20AB9FB5, 0x2EC29247, 0x2F327B6D, 0x550C90A7, 0x721FE76B,
+        0x96CB314A, 0x1679E279, 0x4189DFF4, 0x9794E884, 0xE6E29731, 0x996BED88,
+        0x365F5F0E, 0xFDBBB49A, 0x486CA467, 0x42727132, 0x5D8DB815, 0x9F09E5BC,
+        0x25318D39, 0x74F71C05, 0x30010C0D, 0x68084B58, 0xEE2C90AA, 0x4702E774,
+        0x24D6BDA6, 0x7DF77248, 0x6EEF169F, 0xA6948EF6, 0x91B45153, 0xD1F20ACF,
+        0x3398207E, 0x4BF56863, 0xB25F3EDD, 0x035D407F, 0x89852952, 0x55C06437,
+        0x10D86D32, 0x4832754C, 0x5BD4714E, 0x6E5445C1, 0x090B69F5, 0x2AD56614,
+        0x9D072750, 0x045DDB3B, 0xB4C576EA, 0x17F9877D, 0x6B49BA27, 0x1D296996,
+        0xACCCC654, 0x14AD6AE2, 0x9089D988, 0x50722CBE, 0xA4049407, 0x777030F3,
+        0x27FC00A8, 0x71EA49C2, 0x663DE064, 0x83DD9797, 0x3FA3FD94, 0x438C860D,
+        0xDE41319D, 0x39928C70, 0xDDE7B717, 0x3BDF082B, 0x3715A080, 0x5C93805A,
+        0x921110D8, 0xE80FAF80, 0x6C4BFFDB, 0x0F903876, 0x185915A5, 0x62BBCB61,
+        0xB989C7BD, 0x401004F2, 0xD2277549, 0xF6B6EBBB, 0x22DBAA14, 0x0A2F2689,
+        0x76836433, 0x3B091A94, 0x0EAA3A51, 0xC2A31DAE, 0xEDAF1226, 0x5C4DC26D,
+        0x9C7A2D97, 0x56C0833F, 0x03F6F009, 0x8C402B99, 0x316D07B4, 0x3915200C,
+        0x5BC3D8C4, 0x92F54BAD, 0xC6A5CA4E, 0xCD37A736, 0xA9E69492, 0xAB6842DD,
+        0xDE6319EF, 0x8C76528B, 0x6837DBFC, 0xABA1AE31, 0x15DFA1AE, 0x00DAFB0C,
+        0x664D64B7, 0x05ED3065, 0x29BF5657, 0x3AFF47B9, 0xF96AF3BE, 0x75DF9328,
+        0x3080ABF6, 0x8C6615CB, 0x040622FA, 0x1DE4D9A4, 0xB33D8F1B, 0x5709CD36,
+        0xE9424EA4, 0xBE13B523, 0x331AAAF0, 0xA8654FA5, 0xC1D20F3F, 0x0BCD785B,
+        0x76F92304, 0x8B7B7217, 0x8953A6C6, 0xE26E6F00, 0xEBEF584A, 0x9BB7DAC4,
+        0xBA66AACF, 0xCF761D02, 0xD12DF1B1, 0xC1998C77, 0xADC3DA48, 0x86A05DF7,
+        0xF480C62F, 0xF0AC9AEC, 0xDDBC5C3F, 0x6DDED01F, 0xC790B6DB, 0x2A3A25A3,
+        0x9AAF0093, 0x53AD0457, 0xB6B42D29, 0x7E804BA7, 0x07DA0EAA, 0x76A1597B,
+        0x2A12162D, 0xB7DCFDE5, 0xFAFEDB89, 0xFDBE896C, 0x76E4FCA9, 0x0670803E,
+        0x156E85FF, 0x87FD073E, 0x28336761, 0x86182AEA, 0xBD4DAFE7, 0xB36E6D8F,
+        0x3967955B, 0xBF3148D7, 0x8416DF30, 0x432DC735, 0x6125CE70, 0xC9B8CB30,
+        0xFD6CBFA2, 0x00A4E46C, 0x05A0DD5A, 0x476F21D2, 0x1262845C, 0xB9496170,
+        0xE0566B01, 0x52993755, 0x50B7D51E, 0xC4F1335F, 0x6E13E430, 0x5DA92E85,
+        0xC3B21D36, 0x32A1A4B7, 0x08D4B1EA, 0x21F716E4, 0x698F77FF, 0x2780030C,
+        0x2D408DA0, 0xCD4F99A5, 0x20D3A2B3, 0x0A5D2F42, 0xF9B4CBDA, 0x11D0BE7D,
+        0xC1DB9BBD, 0x17AB81A2, 0xCA5C6A08, 0x17552E55, 0x0027F014, 0x7F8607E1,
+        0x640B148D, 0x4196DEBE, 0x872AFDDA, 0xB6256B34, 0x897BFEF3, 0x059EBFB9,
+        0x4F6A68A8, 0x2A4A5AC4, 0x4FBCF82D, 0x985AD795, 0xC7F48D4D, 0x0DA63A20,
+        0x5F57A4B1, 0x3F149538, 0x800120CC, 0x86DD71B6, 0xDEC9F560, 0xBF11654D,
+        0x6B0701AC, 0xB08CD0C0, 0xB2485551, 0x0EFB1EC3, 0x72953B06, 0xA33540C0,
+        0x7BDC06CC, 0x45E0FA29, 0x4EC8CAD6, 0x41F3E8DE, 0x647CD864, 0x9B31BED9,
+        0xC397A4D4, 0x5877C5E3, 0x6913DAF0, 0x3C3ABA46, 0x18465F75, 0x55F5BDD2,
+        0xC6926E5D, 0x2EACED44, 0x0E423E1C, 0x87C461E9, 0xFD29F3D6, 0xE7CA7C22,
+        0x35916FC5, 0xE0088DD7, 0xFFE26A6E, 0xC6FDB0C1, 0x0893745D, 0x7CB2AD6B,
+        0x9D6ECD7B, 0x723E6A11, 0xC6A9CFF7, 0xDF7329BA, 0xC9B55100, 0xB70DB2E2,
+        0x24BA7460, 0x7DE58AD8, 0x742C150D, 0x0C188194, 0x667E1629, 0x01767A9F,
+        0xBEFDFDEF, 0x4556367E, 0xD913D9EC, 0xB9BA8BFC, 0x97C427A8, 0x31C36EF1,
+        0x36C59456, 0xA8D8B5A8, 0xB40ECCCF, 0x2D891234, 0x576F8956, 0x2CE3CE99,
+        0xB920D6AA, 0x5E6B9C2A, 0x3ECC5F11, 0x4A0BFDFB, 0xF4E16D3B, 0x8E2C86E2,
+        0x84D4E9A9, 0xB4FCD1EE, 0xEFC9352E, 0x61392F44, 0x2138C8D9, 0x1B0AFC81,
+        0x6A4AFBD8, 0x1C2F84B4, 0x538C994E, 0xCC2254DC, 0x552AD6C6, 0xC096190B,
+        0xB8701A64, 0x9569605A, 0x26EE523F, 0x0F117F11, 0xB5F4F5CB, 0xFC2DBC34,
+        0xEEBC34CC, 0x5DE8605E, 0xDD9B8E67, 0xEF3392B8, 0x17C99B58, 0x61BC57E1,
+        0xC6835110, 0x3ED84871, 0xDDDD1C2D, 0xA118AF46, 0x2C21D7F3, 0x59987AD9,
+        0xC0549EFA, 0x864FFC06, 0x56AE79E5, 0x36228922, 0xAD38DC93, 0x67AAE855,
+        0x3826829B, 0xE7CAA40D, 0x51B13399, 0x0ED7A948, 0x0569F0B2, 0x65A7887F,
+        0x974C8836, 0xD1F9B392, 0x214A827B, 0x21CF98DC, 0x9F405547, 0xDC3A74E1,
+        0x42EB67DF, 0x9DFE5FD4, 0x5EA4677B, 0x7AACBAA2, 0xF6552388, 0x2B55BA41,
+        0x086E5986, 0x2A218347, 0x39E6E389, 0xD49EE540, 0xFB49E956, 0xFFCA0F1C,
+        0x8A59C52B, 0xFA94C5C1, 0xD3CFC50F, 0xAE5ADB86, 0xC5476243, 0x853B8621,
+        0x94792C87, 0x61107B4C, 0x2A1A2C80, 0x12BF4390, 0x2688893C, 0x78E4C4A8,
+        0x7BDBE5C2, 0x3AC4EAF4, 0x268A67F7, 0xBF920D2B, 0xA365B193, 0x3D0B7CBD,
+        0xDC51A463, 0xDD27DDE1, 0x6919949A, 0x9529A828, 0xCE68B4ED, 0x09209F44,
+        0xCA984E63, 0x8270237C, 0x7E32B90F, 0x8EF5A7E7, 0x561408F1, 0x212A9DB5,
+        0x4D7E6F51, 0x19A5ABF9, 0xB5D6DF82, 0x61DD9602, 0x36169F3A, 0xC4A1A283,
+        0x6DED727A, 0x8D39A9B8, 0x825C326B, 0x5B2746ED, 0x34007700, 0xD255F4FC,
+        0x4D590180, 0x71E0E13F, 0x89B295F3, 0x64A8F1AE, 0xA74B38FC, 0x4CEAB2BB,
+        0x47270BAB, 0xC3A734BA, 0x6052DD34, 0xF8563AEB, 0x7E8A31BB, 0x365895B7,
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Result of the reduction
+
+    template<typename T>
+    struct rem_pio2_result
+    {
+        // Reduced argument in [-pi/4, pi/4]
+        T value;
+        // Index of the quadrant, in [0, 3]
+        int quadrant;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Payne-Hanek reduction
+
+    // 32 bits of a multiprecision integer starting at bit low,
+    // the limbs being stored from the least significant one
+    template<std::size_t N>
+    constexpr auto bits32(const std::uint32_t (&limbs)[N], int low)
+        -> std::uint32_t
+    {
+        const std::size_t index = low / 32;
+        const int offset = low % 32;
+        std::uint32_t res = 0;
+        if (index < N) {
+            res = limbs[index] >> offset;
+        }
+        if (offset != 0 && index + 1 < N) {
+            res |= limbs[index + 1] << (32 - offset);
+        }
+        return res;
+    }
+
+    // x must be positive and finite
+    template<typename T>
+    constexpr auto payne_hanek(T x)
+        -> rem_pio2_result<T>
+    {
+        using split = pio2_split<std::numeric_limits<T>::digits>;
+        constexpr int digits = std::numeric_limits<T>::digits;
+        // Number of 32-bit limbs for the mantissa, for the
+        // fractional part of the result, for the window of
+        // bits of 2/pi used and for their product
+        constexpr int mant_limbs = (digits + 31) / 32;
+        constexpr int frac_limbs = 6;
+        constexpr int window_limbs = mant_limbs + frac_limbs + 2;
+        constexpr int prod_limbs = mant_limbs + window_limbs;
+
+        // x == M * 2^e0 where M is an integer made of mant_limbs
+        // limbs stored from the least to the most significant
+        int e = 0;
+        T m = detail::frexp_helper(x, &e);
+        std::uint32_t mant[mant_limbs] = {};
+        for (int i = mant_limbs - 1 ; i >= 0 ; --i) {
+            m *= T(4294967296.0);
+            auto limb = static_cast<std::uint32_t>(m);
+            mant[i] = limb;
+            m -= limb;
+        }
+        const int e0 = e - 32 * mant_limbs;
+
+        // The bits of 2/pi of weight greater than 2^(1-e0) only
+        // add multiples of 4 to x * 2/pi, skip them and take a
+        // window of bits starting at the first relevant one
+        const int first_bit = (e0 > 2) ? e0 - 1 : 1;
+        const int word = (first_bit - 1) / 32;
+        const int shift = (first_bit - 1) % 32;
+        std::uint32_t window[window_limbs] = {};
+        for (int i = 0 ; i < window_limbs ; ++i) {
+            std::uint32_t limb = two_over_pi_bits[word + i] << shift;
+            if (shift != 0) {
+                limb |= two_over_pi_bits[word + i + 1] >> (32 - shift);
+            }
+            window[window_limbs - 1 - i] = limb;
+        }
+
+        // Multiply the mantissa by the window
+        std::uint32_t prod[prod_limbs] = {};
+        for (int i = 0 ; i < mant_limbs ; ++i) {
+            std::uint64_t carry = 0;
+            for (int j = 0 ; j < window_limbs ; ++j) {
+                std::uint64_t tmp = std::uint64_t(mant[i]) * window[j]
+                                  + prod[i + j] + carry;
+                prod[i + j] = static_cast<std::uint32_t>(tmp);
+                carry = tmp >> 32;
+            }
+            prod[i + window_limbs] = static_cast<std::uint32_t>(carry);
+        }
+
+        // Position of the binary point in the product
+        const int point = first_bit + 32 * window_limbs - 1 - e0;
+        int quadrant = static_cast<int>(detail::bits32(prod, point) & 3u);
+        std::uint32_t frac[frac_limbs] = {};
+        for (int i = 0 ; i < frac_limbs ; ++i) {
+            frac[i] = detail::bits32(prod, point - 32 * (i + 1));
+        }
+
+        // Round to the nearest quadrant: when the fractional
+        // part is >= 0.5, use its complement to 1 instead
+        bool negative = false;
+        if (frac[0] & 0x80000000u) {
+            negative = true;
+            quadrant = (quadrant + 1) & 3;
+            std::uint64_t borrow = 1;
+            for (int i = frac_limbs - 1 ; i >= 0 ; --i) {
+                std::uint64_t tmp = std::uint64_t(~frac[i]) + borrow;
+                frac[i] = static_cast<std::uint32_t>(tmp);
+                borrow = tmp >> 32;
+            }
+        }
+
+        // Normalize the fractional part
+        int leading_zeros = 0;
+        while (leading_zeros < 32 * frac_limbs
+               && !(frac[leading_zeros / 32] & (0x80000000u >> (leading_zeros % 32)))) {
+            ++leading_zeros;
+        }
+        if (leading_zeros == 32 * frac_limbs) {
+            return { T(0), quadrant };
+        }
+        const int limb_shift = leading_zeros / 32;
+        const int bit_shift = leading_zeros % 32;
+        for (int i = 0 ; i < frac_limbs ; ++i) {
+            std::uint32_t limb = 0;
+            if (i + limb_shift < frac_limbs) {
+                limb = frac[i + limb_shift] << bit_shift;
+                if (bit_shift != 0 && i + limb_shift + 1 < frac_limbs) {
+                    limb |= frac[i + limb_shift + 1] >> (32 - bit_shift);
+                }
+            }
+            frac[i] = limb;
+        }
+
+        // Split the fractional part into hi + lo where hi holds
+        // the highest digits bits, exactly representable in T
+        T hi = 0;
+        T lo = 0;
+        T scale = 1;
+        for (int i = 0 ; i < frac_limbs ; ++i) {
+            scale /= T(4294967296.0);
+            const int kept = digits - 32 * i;
+            std::uint32_t hi_limb = frac[i];
+            if (kept <= 0) {
+                hi_limb = 0;
+            } else if (kept < 32) {
+                hi_limb &= ~(0xFFFFFFFFu >> kept);
+            }
+            hi += T(hi_limb) * scale;
+            lo += T(frac[i] - hi_limb) * scale;
+        }
+
+        // Multiply by pi/2 and undo the normalization
+        T res = hi * split::hi + (hi * split::lo + lo * split::hi);
+        res = detail::ldexp_helper(res, -leading_zeros);
+        return { negative ? -res : res, quadrant };
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Reduction of x to [-pi/4, pi/4]
+
+    // x must be finite, x == value + quadrant * pi/2 [2pi]
+    template<typename T>
+    constexpr auto rem_pio2(T x)
+        -> rem_pio2_result<T>
+    {
+        using split = pio2_split<std::numeric_limits<T>::digits>;
+        constexpr int digits = std::numeric_limits<T>::digits;
+
+        const T abs_x = (x < 0) ? -x : x;
+        if (abs_x <= split::hi / 2) {
+            return { x, 0 };
+        }
+
+        if (abs_x < T(1 << 19)) {
+            // Cody-Waite reduction, k * c1 and k * c2 are exact
+            const T fk = x / split::hi;
+            const long k = static_cast<long>(fk < 0 ? fk - T(0.5) : fk + T(0.5));
+            const T res = ((x - k * split::c1) - k * split::c2) - k * split::c3;
+
+            // The error of the reduction is about 2^(60 - 3*digits),
+            // keep the result if it is accurate enough
+            const T abs_res = (res < 0) ? -res : res;
+            if (abs_res >= detail::pow2<T>(68 - 2 * digits)) {
+                return { res, static_cast<int>(k & 3) };
+            }
+        }
+
+        auto res = detail::payne_hanek(abs_x);
+        if (x < 0) {
+            res.value = -res.value;
+            res.quadrant = (4 - res.quadrant) & 3;
+        }
+        return res;
+    }
+}}
+
+#endif // SMATH_DETAIL_REDUCTION_H_
@@ -0,0 +1,207 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+////////////////////////////////////////////////////////////
+// Construction
+
+template<typename T, std::size_t N>
+template<typename Function>
+constexpr table<T, N>::table(Function func, value_type lower, value_type upper):
+    values_{},
+    lower_(lower),
+    upper_(upper),
+    step_((upper - lower) / (N - 1)),
+    inv_step_((N - 1) / (upper - lower)),
+    linear_error_(0),
+    cubic_error_(0)
+{
+    for (size_type i = 0 ; i < N - 1 ; ++i) {
+        values_[i] = static_cast<value_type>(func(lower + i * step_));
+    }
+    values_[N - 1] = static_cast<value_type>(func(upper));
+
+    // The interpolation errors are measured at several points of
+    // every interval, since the largest error of the one-sided
+    // stencils of the edge intervals isn't in their middle
+    constexpr size_type samples = 8;
+    value_type magnitude = 0;
+    for (size_type i = 0 ; i < N ; ++i) {
+        if (smath::abs(values_[i]) > magnitude) {
+            magnitude = smath::abs(values_[i]);
+        }
+    }
+    for (size_type i = 0 ; i < N - 1 ; ++i) {
+        for (size_type k = 1 ; k < samples ; ++k) {
+            const value_type x = lower + (i + value_type(k) / samples) * step_;
+            const auto expected = static_cast<value_type>(func(x));
+            const value_type linear_diff = smath::abs(linear(x) - expected);
+            const value_type cubic_diff = smath::abs(cubic(x) - expected);
+            if (linear_diff > linear_error_) {
+                linear_error_ = linear_diff;
+            }
+            if (cubic_diff > cubic_error_) {
+                cubic_error_ = cubic_diff;
+            }
+        }
+    }
+
+    // Safety margin for the error between two measurement points,
+    // and for the rounding errors of the interpolation itself
+    const value_type rounding = 8 * std::numeric_limits<value_type>::epsilon() * magnitude;
+    linear_error_ = linear_error_ * value_type(1.25) + rounding;
+    cubic_error_ = cubic_error_ * value_type(1.25) + rounding;
+}
+
+template<std::size_t N, typename T, typename Function>
+constexpr auto make_table(Function func, T lower, T upper)
+    -> table<T, N>
+{
+    return { func, lower, upper };
+}
+
+////////////////////////////////////////////////////////////
+// Interpolation
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::position(value_type x) const
+    -> value_type
+{
+    const value_type pos = (x - lower_) * inv_step_;
+    // Also catches NaN
+    if (!(pos > 0)) {
+        return 0;
+    }
+    if (pos > N - 1) {
+        return N - 1;
+    }
+    return pos;
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::operator()(value_type x) const
+    -> value_type
+{
+    return linear(x);
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::linear(value_type x) const
+    -> value_type
+{
+    const value_type pos = position(x);
+    size_type i = static_cast<size_type>(pos);
+    if (i > N - 2) {
+        i = N - 2;
+    }
+    const value_type u = pos - i;
+    return values_[i] + u * (values_[i + 1] - values_[i]);
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::cubic(value_type x) const
+    -> value_type
+{
+    // The first and last intervals reuse the closest inner stencil
+    const value_type pos = position(x);
+    size_type i = static_cast<size_type>(pos);
+    if (i < 1) {
+        i = 1;
+    }
+    if (i > N - 3) {
+        i = N - 3;
+    }
+    const value_type u = pos - i;
+
+    // Lagrange polynomial through the values at i-1, i, i+1, i+2
+    const value_type y0 = values_[i - 1];
+    const value_type y1 = values_[i];
+    const value_type y2 = values_[i + 1];
+    const value_type y3 = values_[i + 2];
+    const value_type c1 = y2 - y0 / 3 - y1 / 2 - y3 / 6;
+    const value_type c2 = (y0 + y2) / 2 - y1;
+    const value_type c3 = (y3 - y0) / 6 + (y1 - y2) / 2;
+    return ((c3 * u + c2) * u + c1) * u + y1;
+}
+
+////////////////////////////////////////////////////////////
+// Error bounds
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::linear_error() const
+    -> value_type
+{
+    return linear_error_;
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::cubic_error() const
+    -> value_type
+{
+    return cubic_error_;
+}
+
+////////////////////////////////////////////////////////////
+// Accessors
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::operator[](size_type i) const
+    -> value_type
+{
+    return values_[i];
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::data() const
+    -> const_pointer
+{
+    return values_;
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::size() const
+    -> size_type
+{
+    return N;
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::lower() const
+    -> value_type
+{
+    return lower_;
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::upper() const
+    -> value_type
+{
+    return upper_;
+}
+
+template<typename T, std::size_t N>
+constexpr auto table<T, N>::step() const
+    -> value_type
+{
+    return step_;
+}
@@ -33,7 +33,8 @@ template<typename Float>
 constexpr auto cot(Float x)
     -> Float
 {
-    return smath::cos(x) / smath::sin(x);
+    const auto res = smath::sincos(x);
+    return static_cast<Float>(res.cos / res.sin);
 }
 
 template<typename Float>
@@ -57,7 +58,8 @@ template<typename Float>
 constexpr auto coth(Float x)
     -> Float
 {
-    return smath::cosh(x) / smath::sinh(x);
+    // cosh / sinh would be inf / inf once both saturate
+    return static_cast<Float>(1 / smath::tanh(x));
 }
 
 template<typename Float>
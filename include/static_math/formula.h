@@ -28,6 +28,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <type_traits>
+#include <static_math/bit.h>
 #include <static_math/constants.h>
 #include "detail/core.h"
 
@@ -140,6 +141,28 @@ namespace smath
     constexpr auto factorial(Integer n)
         -> decltype(auto);
 
+    /**
+     * @brief Selects Euclid's algorithm, which performs a modulo
+     *        at every step, to compute gcd and lcm.
+     */
+    struct euclidean_gcd_t
+    {
+        explicit euclidean_gcd_t() = default;
+    };
+
+    constexpr euclidean_gcd_t euclidean_gcd{};
+
+    /**
+     * @brief Selects Stein's binary algorithm, which only relies
+     *        on shifts and subtractions, to compute gcd and lcm.
+     */
+    struct binary_gcd_t
+    {
+        explicit binary_gcd_t() = default;
+    };
+
+    constexpr binary_gcd_t binary_gcd{};
+
     /**
      * @brief Greatest common divisor
      * @param a Some integer
@@ -150,6 +173,14 @@ namespace smath
     constexpr auto gcd(T a, U b)
         -> std::common_type_t<T, U>;
 
+    template<typename T, typename U>
+    constexpr auto gcd(euclidean_gcd_t, T a, U b)
+        -> std::common_type_t<T, U>;
+
+    template<typename T, typename U>
+    constexpr auto gcd(binary_gcd_t, T a, U b)
+        -> std::common_type_t<T, U>;
+
     /**
      * @brief Least common multiple
      * @param a Some integer
@@ -160,6 +191,14 @@ namespace smath
     constexpr auto lcm(T a, U b)
         -> std::common_type_t<T, U>;
 
+    template<typename T, typename U>
+    constexpr auto lcm(euclidean_gcd_t, T a, U b)
+        -> std::common_type_t<T, U>;
+
+    template<typename T, typename U>
+    constexpr auto lcm(binary_gcd_t, T a, U b)
+        -> std::common_type_t<T, U>;
+
     ////////////////////////////////////////////////////////////
     // Angle conversions
 
@@ -28,12 +28,26 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <cmath>
+#include <limits>
 #include <type_traits>
 #include <static_math/cmath.h>
 #include <static_math/formula.h>
+#include "detail/overflow.h"
 
 namespace smath
 {
+    namespace detail
+    {
+        // Tag to construct a rational from an already simplified
+        // fraction whose denominator is positive
+        struct reduced_t
+        {
+            explicit reduced_t() = default;
+        };
+
+        constexpr reduced_t reduced{};
+    }
+
     /**
      * @brief Rational numbers
      */
@@ -53,6 +67,7 @@ namespace smath
 
         constexpr rational(value_type numerator);
         constexpr rational(value_type numerator, value_type denominator);
+        constexpr rational(detail::reduced_t, value_type numerator, value_type denominator);
 
         ////////////////////////////////////////////////////////////
         // Cast
@@ -68,6 +83,11 @@ namespace smath
 
         const value_type numer;
         const value_type denom;
+
+    private:
+
+        constexpr rational(value_type numerator, value_type denominator,
+                           value_type divisor);
     };
 
     ////////////////////////////////////////////////////////////
@@ -122,6 +142,50 @@ namespace smath
     constexpr auto operator/(Integer lhs, rational<T> rhs)
         -> rational<std::common_type_t<T, Integer>>;
 
+    ////////////////////////////////////////////////////////////
+    // Overflow-checked arithmetic operations
+
+    /**
+     * @brief Result of an overflow-checked rational operation
+     *
+     * value is only meaningful when overflow is false.
+     */
+    template<typename T>
+    struct checked_rational
+    {
+        rational<T> value;
+        bool overflow;
+    };
+
+    template<typename T, typename U>
+    constexpr auto checked_add(rational<T> lhs, rational<U> rhs)
+        -> checked_rational<std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto checked_sub(rational<T> lhs, rational<U> rhs)
+        -> checked_rational<std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto checked_mul(rational<T> lhs, rational<U> rhs)
+        -> checked_rational<std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto checked_div(rational<T> lhs, rational<U> rhs)
+        -> checked_rational<std::common_type_t<T, U>>;
+
+    ////////////////////////////////////////////////////////////
+    // Widening arithmetic operations
+
+    template<typename T, typename U>
+    constexpr auto widening_add(rational<T> lhs, rational<U> rhs)
+        -> detail::apply_widened_t<rational, std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto widening_sub(rational<T> lhs, rational<U> rhs)
+        -> detail::apply_widened_t<rational, std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto widening_mul(rational<T> lhs, rational<U> rhs)
+        -> detail::apply_widened_t<rational, std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto widening_div(rational<T> lhs, rational<U> rhs)
+        -> detail::apply_widened_t<rational, std::common_type_t<T, U>>;
+
     ////////////////////////////////////////////////////////////
     // Relational operators
 
@@ -217,6 +281,196 @@ namespace smath
     constexpr auto pow(rational<T> ratio, Integer exp)
         -> rational<T>;
 
+    /**
+     * @brief Rational numbers with deferred normalization
+     *
+     * Arithmetic operations do not simplify the result, which
+     * saves the computation of a gcd per operation when many
+     * operations are chained. The fraction is only simplified
+     * when it is converted or when the next operation could
+     * overflow. The denominator is always positive.
+     */
+    template<typename T>
+    struct lazy_rational
+    {
+        static_assert(std::is_integral<T>::value,
+                      "a lazy_rational can only contain integral values");
+
+        ////////////////////////////////////////////////////////////
+        // Types
+
+        using value_type = T;
+
+        ////////////////////////////////////////////////////////////
+        // Constructors
+
+        constexpr lazy_rational(value_type numerator);
+        constexpr lazy_rational(value_type numerator, value_type denominator);
+        constexpr lazy_rational(rational<value_type> ratio);
+
+        ////////////////////////////////////////////////////////////
+        // Normalization
+
+        constexpr auto normalize()
+            -> lazy_rational&;
+
+        ////////////////////////////////////////////////////////////
+        // Compound assignment operators
+
+        constexpr auto operator+=(lazy_rational other)
+            -> lazy_rational&;
+        constexpr auto operator-=(lazy_rational other)
+            -> lazy_rational&;
+        constexpr auto operator*=(lazy_rational other)
+            -> lazy_rational&;
+        constexpr auto operator/=(lazy_rational other)
+            -> lazy_rational&;
+
+        ////////////////////////////////////////////////////////////
+        // Cast
+
+        constexpr operator rational<value_type>() const;
+
+        constexpr explicit operator float() const;
+        constexpr explicit operator double() const;
+        constexpr explicit operator long double() const;
+
+        constexpr explicit operator bool() const;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+
+        value_type numer;
+        value_type denom;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Unary arithmetic operators
+
+    template<typename T>
+    constexpr auto operator+(lazy_rational<T> lhs)
+        -> lazy_rational<T>;
+    template<typename T>
+    constexpr auto operator-(lazy_rational<T> lhs)
+        -> lazy_rational<T>;
+
+    ////////////////////////////////////////////////////////////
+    // Binary arithmetic operators
+
+    template<typename T, typename U>
+    constexpr auto operator+(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> lazy_rational<std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto operator-(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> lazy_rational<std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto operator*(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> lazy_rational<std::common_type_t<T, U>>;
+    template<typename T, typename U>
+    constexpr auto operator/(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> lazy_rational<std::common_type_t<T, U>>;
+
+    template<typename T, typename Integer>
+    constexpr auto operator+(lazy_rational<T> lhs, Integer rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+    template<typename T, typename Integer>
+    constexpr auto operator-(lazy_rational<T> lhs, Integer rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+    template<typename T, typename Integer>
+    constexpr auto operator*(lazy_rational<T> lhs, Integer rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+    template<typename T, typename Integer>
+    constexpr auto operator/(lazy_rational<T> lhs, Integer rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+
+    template<typename T, typename Integer>
+    constexpr auto operator+(Integer lhs, lazy_rational<T> rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+    template<typename T, typename Integer>
+    constexpr auto operator-(Integer lhs, lazy_rational<T> rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+    template<typename T, typename Integer>
+    constexpr auto operator*(Integer lhs, lazy_rational<T> rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+    template<typename T, typename Integer>
+    constexpr auto operator/(Integer lhs, lazy_rational<T> rhs)
+        -> lazy_rational<std::common_type_t<T, Integer>>;
+
+    ////////////////////////////////////////////////////////////
+    // Relational operators
+
+    template<typename T, typename U>
+    constexpr auto operator==(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> bool;
+    template<typename T, typename U>
+    constexpr auto operator!=(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> bool;
+    template<typename T, typename U>
+    constexpr auto operator<(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> bool;
+    template<typename T, typename U>
+    constexpr auto operator>(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> bool;
+    template<typename T, typename U>
+    constexpr auto operator<=(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> bool;
+    template<typename T, typename U>
+    constexpr auto operator>=(lazy_rational<T> lhs, lazy_rational<U> rhs)
+        -> bool;
+
+    template<typename T, typename Integer>
+    constexpr auto operator==(lazy_rational<T> lhs, Integer rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator!=(lazy_rational<T> lhs, Integer rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator<(lazy_rational<T> lhs, Integer rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator>(lazy_rational<T> lhs, Integer rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator<=(lazy_rational<T> lhs, Integer rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator>=(lazy_rational<T> lhs, Integer rhs)
+        -> bool;
+
+    template<typename T, typename Integer>
+    constexpr auto operator==(Integer lhs, lazy_rational<T> rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator!=(Integer lhs, lazy_rational<T> rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator<(Integer lhs, lazy_rational<T> rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator>(Integer lhs, lazy_rational<T> rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator<=(Integer lhs, lazy_rational<T> rhs)
+        -> bool;
+    template<typename T, typename Integer>
+    constexpr auto operator>=(Integer lhs, lazy_rational<T> rhs)
+        -> bool;
+
+    ////////////////////////////////////////////////////////////
+    // Mathematical functions
+
+    template<typename T>
+    constexpr auto sign(lazy_rational<T> ratio)
+        -> int;
+
+    template<typename T>
+    constexpr auto abs(lazy_rational<T> ratio)
+        -> lazy_rational<T>;
+
+    template<typename T>
+    constexpr auto reciprocal(lazy_rational<T> ratio)
+        -> lazy_rational<T>;
+
     inline namespace literals
     {
     inline namespace rational_literals
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <static_math/batch.h>
 #include <static_math/bit.h>
 #include <static_math/cmath.h>
 #include <static_math/complex.h>
@@ -34,6 +35,7 @@
 #include <static_math/constants.h>
 #include <static_math/formula.h>
 #include <static_math/rational.h>
+#include <static_math/table.h>
 #include <static_math/trigonometry.h>
 
 /**
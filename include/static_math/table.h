@@ -0,0 +1,155 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef SMATH_TABLE_H_
+#define SMATH_TABLE_H_
+
+/**
+ * @file static_math/table.h
+ * @brief Uniformly sampled lookup tables.
+ *
+ * This header provides lookup tables filled with the values of a
+ * function at compile time, and which approximate that function
+ * in constant time with linear or cubic interpolation.
+ */
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <static_math/cmath.h>
+
+namespace smath
+{
+    /**
+     * @brief Values of a function sampled at N evenly spaced
+     *        points of [lower, upper].
+     *
+     * The table is aligned on a cache line so that small tables
+     * occupy as few cache lines as possible.
+     */
+    template<typename T, std::size_t N>
+    struct alignas(64) table
+    {
+        static_assert(std::is_floating_point<T>::value,
+                      "a table can only contain floating point values");
+        static_assert(N >= 4, "a table needs at least 4 values");
+
+        ////////////////////////////////////////////////////////////
+        // Types
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_pointer = const T*;
+
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        // func must be callable in a constant expression
+        template<typename Function>
+        constexpr table(Function func, value_type lower, value_type upper);
+
+        ////////////////////////////////////////////////////////////
+        // Interpolation
+
+        // Arguments out of [lower, upper] are clamped to that range
+
+        /**
+         * @brief Linear interpolation, same as linear(x).
+         */
+        constexpr auto operator()(value_type x) const
+            -> value_type;
+
+        /**
+         * @brief Linear interpolation between the two closest values.
+         */
+        constexpr auto linear(value_type x) const
+            -> value_type;
+
+        /**
+         * @brief Cubic interpolation through the four closest values.
+         */
+        constexpr auto cubic(value_type x) const
+            -> value_type;
+
+        ////////////////////////////////////////////////////////////
+        // Error bounds
+
+        // Maximal errors measured at several points of every
+        // interval while building the table, widened by a margin
+
+        constexpr auto linear_error() const
+            -> value_type;
+
+        constexpr auto cubic_error() const
+            -> value_type;
+
+        ////////////////////////////////////////////////////////////
+        // Accessors
+
+        constexpr auto operator[](size_type i) const
+            -> value_type;
+
+        constexpr auto data() const
+            -> const_pointer;
+
+        constexpr auto size() const
+            -> size_type;
+
+        constexpr auto lower() const
+            -> value_type;
+
+        constexpr auto upper() const
+            -> value_type;
+
+        constexpr auto step() const
+            -> value_type;
+
+        private:
+
+            // Position of x in the table, in number of steps
+            constexpr auto position(value_type x) const
+                -> value_type;
+
+            value_type values_[N];
+            value_type lower_;
+            value_type upper_;
+            value_type step_;
+            value_type inv_step_;
+            value_type linear_error_;
+            value_type cubic_error_;
+    };
+
+    /**
+     * @brief Builds a table of N values of func on [lower, upper].
+     */
+    template<std::size_t N, typename T, typename Function>
+    constexpr auto make_table(Function func, T lower, T upper)
+        -> table<T, N>;
+
+    #include "detail/table.inl"
+}
+
+#endif // SMATH_TABLE_H_
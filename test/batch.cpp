@@ -0,0 +1,374 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <static_math/batch.h>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Inputs and expected results, computed at compile time so
+    // that the strict batch functions are checked against the
+    // constexpr results regardless of the compiler options
+
+    constexpr std::size_t special_size = 22;
+    constexpr std::size_t random_size = 256;
+    constexpr std::size_t size = special_size + random_size;
+
+    template<std::size_t N>
+    struct values
+    {
+        double data[N];
+    };
+
+    constexpr auto special_inputs()
+        -> values<special_size>
+    {
+        return {{
+            0.0, -0.0, 1.0, -1.0, 0.5, 2.0, 1e-300, 5e-324, -5e-324,
+            1e22, -1e22, 1e300, 708.5, -708.5, 709.7, -745.0, 1000.0,
+            std::numeric_limits<double>::min(),
+            std::numeric_limits<double>::max(),
+            std::numeric_limits<double>::infinity(),
+            -std::numeric_limits<double>::infinity(),
+            std::numeric_limits<double>::quiet_NaN()
+        }};
+    }
+
+    // The special inputs followed by pseudo-random numbers in
+    // [low, high) generated with a 64-bit LCG
+    constexpr auto make_inputs(double low, double high, std::uint64_t seed=0x5eed)
+        -> values<size>
+    {
+        values<size> res = {};
+        const auto specials = special_inputs();
+        for (std::size_t i = 0 ; i < special_size ; ++i) {
+            res.data[i] = specials.data[i];
+        }
+
+        std::uint64_t state = seed;
+        for (std::size_t i = special_size ; i < size ; ++i) {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            const double unit = static_cast<double>(state >> 11) / 9007199254740992.0;
+            res.data[i] = low + (high - low) * unit;
+        }
+        return res;
+    }
+
+    template<typename Function, std::size_t N>
+    constexpr auto apply(Function func, const values<N>& inputs)
+        -> values<N>
+    {
+        values<N> res = {};
+        for (std::size_t i = 0 ; i < N ; ++i) {
+            res.data[i] = func(inputs.data[i]);
+        }
+        return res;
+    }
+
+    struct sin_function
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::detail::sin_helper(x);
+        }
+    };
+
+    struct cos_function
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::detail::cos_helper(x);
+        }
+    };
+
+    struct exp_function
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::detail::exp_helper(x);
+        }
+    };
+
+    struct log_function
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::detail::logf_helper(x);
+        }
+    };
+
+    struct sqrt_function
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::detail::sqrt_helper(x);
+        }
+    };
+
+    constexpr auto sin_inputs = make_inputs(-1e3, 1e3);
+    constexpr auto sin_results = apply(sin_function{}, sin_inputs);
+    constexpr auto cos_results = apply(cos_function{}, sin_inputs);
+    constexpr auto exp_inputs = make_inputs(-750.0, 750.0);
+    constexpr auto exp_results = apply(exp_function{}, exp_inputs);
+    constexpr auto log_inputs = make_inputs(0.0, 1e3);
+    constexpr auto log_results = apply(log_function{}, log_inputs);
+    constexpr auto sqrt_inputs = make_inputs(0.0, 1e6);
+    constexpr auto sqrt_results = apply(sqrt_function{}, sqrt_inputs);
+
+    // The special inputs paired with every kind of other coordinate,
+    // followed by random coordinates
+    constexpr std::size_t hypot_pair_size = 2 * special_size * 5;
+    constexpr std::size_t hypot_size = hypot_pair_size + random_size;
+
+    struct hypot_values
+    {
+        double x[hypot_size];
+        double y[hypot_size];
+        double z[hypot_size];
+        double xy[hypot_size];
+        double xyz[hypot_size];
+    };
+
+    constexpr auto make_hypot_values()
+        -> hypot_values
+    {
+        hypot_values res = {};
+        const auto specials = special_inputs();
+        const double others[] = { 0.0, 1.0, 1e-310, 1e300, specials.data[special_size - 1] };
+
+        std::size_t i = 0;
+        for (double special: specials.data) {
+            for (double other: others) {
+                res.x[i] = special;
+                res.y[i] = other;
+                res.z[i] = special;
+                ++i;
+                res.x[i] = other;
+                res.y[i] = special;
+                res.z[i] = other;
+                ++i;
+            }
+        }
+
+        const auto xs = make_inputs(-1e3, 1e3, 1);
+        const auto ys = make_inputs(-1e3, 1e3, 2);
+        const auto zs = make_inputs(-1e-3, 1e-3, 3);
+        for (std::size_t j = 0 ; j < random_size ; ++j, ++i) {
+            res.x[i] = xs.data[special_size + j];
+            res.y[i] = ys.data[special_size + j];
+            res.z[i] = zs.data[special_size + j];
+        }
+
+        for (i = 0 ; i < hypot_size ; ++i) {
+            res.xy[i] = smath::detail::hypot_helper(res.x[i], res.y[i]);
+            res.xyz[i] = smath::detail::hypot_helper(res.x[i], res.y[i], res.z[i]);
+        }
+        return res;
+    }
+
+    constexpr auto hypot_data = make_hypot_values();
+
+    ////////////////////////////////////////////////////////////
+    // Comparisons
+
+    auto same_bits(double lhs, double rhs)
+        -> bool
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+    }
+
+    auto close(double lhs, double rhs)
+        -> bool
+    {
+        return same_bits(lhs, rhs) || std::fabs(lhs - rhs) <= 4e-16 * std::fabs(rhs);
+    }
+
+    // Checks a batch function against the compile-time results, on
+    // every size up to a few vectors to exercise the loop tails
+    template<typename Batch, typename StrictBatch>
+    auto check(Batch batch, StrictBatch strict_batch,
+               const values<size>& inputs, const values<size>& expected)
+        -> bool
+    {
+        bool res = true;
+        for (std::size_t n = 0 ; n <= size ; n += (n < 40 ? 1 : 37)) {
+            std::vector<double> fast(n), strict(n);
+            auto end = batch(inputs.data, inputs.data + n, fast.data());
+            strict_batch(inputs.data, inputs.data + n, strict.data());
+            res = res && end == fast.data() + n;
+            for (std::size_t i = 0 ; i < n ; ++i) {
+                res = res && same_bits(strict[i], expected.data[i]);
+                res = res && close(fast[i], expected.data[i]);
+            }
+        }
+
+        // In place transformation
+        std::vector<double> in_place(inputs.data, inputs.data + size);
+        strict_batch(in_place.data(), in_place.data() + size, in_place.data());
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            res = res && same_bits(in_place[i], expected.data[i]);
+        }
+        return res;
+    }
+
+    // Checks the 2D and 3D hypot against the compile-time results
+    auto check_hypot()
+        -> bool
+    {
+        const auto& data = hypot_data;
+
+        bool res = true;
+        for (std::size_t n = 0 ; n <= hypot_size ; n += (n < 40 ? 1 : 37)) {
+            std::vector<double> fast(n), strict(n), fast3(n), strict3(n);
+            auto end = smath::batch::hypot(data.x, data.x + n, data.y, fast.data());
+            smath::batch::hypot(smath::batch::strict, data.x, data.x + n, data.y, strict.data());
+            auto end3 = smath::batch::hypot(data.x, data.x + n, data.y, data.z, fast3.data());
+            smath::batch::hypot(smath::batch::strict, data.x, data.x + n, data.y, data.z, strict3.data());
+            res = res && end == fast.data() + n && end3 == fast3.data() + n;
+            for (std::size_t i = 0 ; i < n ; ++i) {
+                res = res && same_bits(strict[i], data.xy[i]);
+                res = res && close(fast[i], data.xy[i]);
+                res = res && same_bits(strict3[i], data.xyz[i]);
+                res = res && close(fast3[i], data.xyz[i]);
+            }
+        }
+
+        // In place transformation
+        std::vector<double> in_place(data.y, data.y + hypot_size);
+        smath::batch::hypot(smath::batch::strict, data.x, data.x + hypot_size, in_place.data(), in_place.data());
+        for (std::size_t i = 0 ; i < hypot_size ; ++i) {
+            res = res && same_bits(in_place[i], data.xy[i]);
+        }
+        return res;
+    }
+
+#if defined(__cpp_lib_span)
+    // Checks the overloads taking contiguous ranges, which accept
+    // containers as well as spans
+    auto check_ranges()
+        -> bool
+    {
+        const std::vector<double> inputs(sin_inputs.data, sin_inputs.data + size);
+        std::vector<double> results(size);
+        std::vector<double> strict_results(size);
+        smath::batch::sin(inputs, results);
+        smath::batch::sin(smath::batch::strict, std::span<const double>(inputs), strict_results);
+
+        bool res = true;
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            res = res && close(results[i], sin_results.data[i]);
+            res = res && same_bits(strict_results[i], sin_results.data[i]);
+        }
+
+        // In place transformation of a container
+        std::vector<double> in_place(exp_inputs.data, exp_inputs.data + size);
+        smath::batch::exp(smath::batch::strict, in_place, in_place);
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            res = res && same_bits(in_place[i], exp_results.data[i]);
+        }
+
+        // Output bigger than the input, only the first elements
+        // are written
+        double outputs[size + 1] = {};
+        smath::batch::sqrt(smath::batch::strict, sqrt_inputs.data, outputs);
+        res = res && outputs[size] == 0.0;
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            res = res && same_bits(outputs[i], sqrt_results.data[i]);
+        }
+
+        const auto& data = hypot_data;
+        std::vector<double> norms(hypot_size);
+        smath::batch::hypot(smath::batch::strict, data.x, data.y, norms);
+        for (std::size_t i = 0 ; i < hypot_size ; ++i) {
+            res = res && same_bits(norms[i], data.xy[i]);
+        }
+        smath::batch::hypot(smath::batch::strict, std::span(data.x), data.y, data.z, std::span(norms));
+        for (std::size_t i = 0 ; i < hypot_size ; ++i) {
+            res = res && same_bits(norms[i], data.xyz[i]);
+        }
+        smath::batch::hypot(data.x, data.y, data.z, norms);
+        for (std::size_t i = 0 ; i < hypot_size ; ++i) {
+            res = res && close(norms[i], data.xyz[i]);
+        }
+        return res;
+    }
+#endif
+}
+
+int main()
+{
+    using namespace smath;
+
+    bool res = true;
+    res = res && check(
+        [](const double* first, const double* last, double* out) { return batch::sin(first, last, out); },
+        [](const double* first, const double* last, double* out) { return batch::sin(batch::strict, first, last, out); },
+        sin_inputs, sin_results
+    );
+    res = res && check(
+        [](const double* first, const double* last, double* out) { return batch::cos(first, last, out); },
+        [](const double* first, const double* last, double* out) { return batch::cos(batch::strict, first, last, out); },
+        sin_inputs, cos_results
+    );
+    res = res && check(
+        [](const double* first, const double* last, double* out) { return batch::exp(first, last, out); },
+        [](const double* first, const double* last, double* out) { return batch::exp(batch::strict, first, last, out); },
+        exp_inputs, exp_results
+    );
+    res = res && check(
+        [](const double* first, const double* last, double* out) { return batch::log(first, last, out); },
+        [](const double* first, const double* last, double* out) { return batch::log(batch::strict, first, last, out); },
+        log_inputs, log_results
+    );
+    res = res && check(
+        [](const double* first, const double* last, double* out) { return batch::sqrt(first, last, out); },
+        [](const double* first, const double* last, double* out) { return batch::sqrt(batch::strict, first, last, out); },
+        sqrt_inputs, sqrt_results
+    );
+    res = res && check_hypot();
+#if defined(__cpp_lib_span)
+    res = res && check_ranges();
+#endif
+
+    // Other types use the scalar kernels
+    float floats[] = { 0.0f, 0.5f, 1.0f, 2.0f, 3.0f };
+    float float_res[5];
+    batch::sin(std::begin(floats), std::end(floats), float_res);
+    for (int i = 0 ; i < 5 ; ++i) {
+        res = res && float_res[i] == detail::sin_helper(floats[i]);
+    }
+
+    return res ? EXIT_SUCCESS : EXIT_FAILURE;
+}
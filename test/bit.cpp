@@ -23,6 +23,7 @@
  */
 #include <ciso646>
 #include <cstdlib>
+#include <limits>
 #include <type_traits>
 #include <static_math/constant.h>
 #include <static_math/bit.h>
@@ -60,6 +61,18 @@ int main()
     static_assert(smath::log2p1(4u) == 3u, "");
     static_assert(smath::log2p1(123u) == 7u, "");
 
+    static_assert(smath::countr_zero(0u) == std::numeric_limits<unsigned>::digits, "");
+    static_assert(smath::countr_zero(1u) == 0, "");
+    static_assert(smath::countr_zero(2u) == 1, "");
+    static_assert(smath::countr_zero(12u) == 2, "");
+    static_assert(smath::countr_zero(0x80000000u) == 31, "");
+    static_assert(smath::countr_zero(static_cast<unsigned char>(0x40)) == 6, "");
+    static_assert(smath::countr_zero(1ull << 63) == 63, "");
+    static_assert(smath::detail::countr_zero_loop(static_cast<unsigned char>(0x40)) == 6, "");
+    static_assert(smath::detail::countr_zero_loop(12u) == 2, "");
+    static_assert(smath::detail::countr_zero_loop(1ull << 63) == 63, "");
+    static_assert(smath::detail::countr_zero_loop(0xffffffffffffffffull) == 0, "");
+
     ////////////////////////////////////////////////////////////
     // smath::constant overloads
 
@@ -113,5 +126,11 @@ int main()
     static_assert(smath::log2p1(3_cu) == 2_cu, "");
     static_assert(smath::log2p1(4_cu) == 3_cu, "");
     static_assert(smath::log2p1(123_cu) == 7_cu, "");
+
+    static_assert(
+        std::is_same<
+            decltype(smath::countr_zero(12_cu)),
+            smath::constant<int, 2>
+        >::value, "");
 #endif
 }
@@ -22,10 +22,37 @@
  * THE SOFTWARE.
  */
 #include <cstdlib>
+#include <limits>
 #include <static_math/cmath.h>
 #include <static_math/constants.h>
 #include <static_math/formula.h>
 
+namespace
+{
+    constexpr auto frexp_mantissa(double x)
+        -> double
+    {
+        int exp = 0;
+        return smath::frexp(x, &exp);
+    }
+
+    constexpr auto frexp_exponent(double x)
+        -> int
+    {
+        int exp = 0;
+        smath::frexp(x, &exp);
+        return exp;
+    }
+
+    constexpr auto remquo_quotient(double x, double y)
+        -> int
+    {
+        int quo = 0;
+        smath::remquo(x, y, &quo);
+        return quo;
+    }
+}
+
 int main()
 {
     ////////////////////////////////////////////////////////////
@@ -92,6 +119,101 @@ int main()
     static_assert(smath::trunc(2.8) == 2.0, "");
     static_assert(smath::trunc(-2.1) == -2.0, "");
 
+    // Values that don't fit in an int
+    static_assert(smath::floor(1.0e12 + 0.5) == 1.0e12, "");
+    static_assert(smath::floor(-1.0e12 - 0.5) == -1.0e12 - 1.0, "");
+    static_assert(smath::ceil(1.0e12 + 0.5) == 1.0e12 + 1.0, "");
+    static_assert(smath::round(1.0e12 + 0.5) == 1.0e12 + 1.0, "");
+    static_assert(smath::round(-1.0e12 - 0.25) == -1.0e12, "");
+    static_assert(smath::trunc(-1.0e12 - 0.75) == -1.0e12, "");
+    static_assert(smath::trunc(1.0e300) == 1.0e300, "");
+    static_assert(smath::floor(4503599627370497.0) == 4503599627370497.0, "");
+    static_assert(smath::round(4503599627370497.0) == 4503599627370497.0, "");
+    static_assert(smath::floor(3.0e9f) == 3.0e9f, "");
+    static_assert(smath::floor(-2.5f) == -3.0f, "");
+    static_assert(smath::round(1.0e15L + 0.5L) == 1.0e15L + 1.0L, "");
+    static_assert(smath::trunc(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::floor(0) == 0.0, "");
+
+    // x + 0.5 rounds up to 1 for the predecessor of 0.5
+    static_assert(smath::round(0.49999999999999994) == 0.0, "");
+    static_assert(smath::round(-0.5) == -1.0, "");
+    static_assert(smath::signbit(smath::trunc(-0.5)), "");
+    static_assert(smath::signbit(smath::ceil(-0.5)), "");
+
+    static_assert(smath::fmod(5.5, 2.0) == 1.5, "");
+    static_assert(smath::fmod(-5.5, 2.0) == -1.5, "");
+    static_assert(smath::fmod(5.5, -2.0) == 1.5, "");
+    static_assert(smath::fmod(1.0, 3.0) == 1.0, "");
+    static_assert(smath::fmod(7, 2) == 1.0, "");
+    static_assert(smath::fmod(1.0e300, 3.0) == 0.0, "");
+    static_assert(smath::fmod(0.7, 0.1) == 0.09999999999999992, "");
+    static_assert(smath::fmod(1.0e10f, 0.1f) == 0.0883902833f, "");
+    static_assert(smath::fmod(1.0, std::numeric_limits<double>::denorm_min() * 3) == std::numeric_limits<double>::denorm_min(), "");
+    static_assert(smath::fmod(3.0, std::numeric_limits<double>::infinity()) == 3.0, "");
+    static_assert(smath::signbit(smath::fmod(-4.0, 2.0)), "");
+    static_assert(smath::fmod(std::numeric_limits<double>::infinity(), 2.0) != smath::fmod(std::numeric_limits<double>::infinity(), 2.0), "");
+    static_assert(smath::fmod(2.0, 0.0) != smath::fmod(2.0, 0.0), "");
+
+    static_assert(smath::remainder(5.0, 3.0) == -1.0, "");
+    static_assert(smath::remainder(5.0, 2.0) == 1.0, "");
+    static_assert(smath::remainder(7.0, 2.0) == -1.0, "");
+    static_assert(smath::remainder(-7.0, 2.0) == 1.0, "");
+    static_assert(smath::remainder(std::numeric_limits<double>::max(), 3.0) == -1.0, "");
+    static_assert(remquo_quotient(7.0, 2.0) == 4, "");
+    static_assert(remquo_quotient(-7.0, 2.0) == -4, "");
+    static_assert(remquo_quotient(29.0, 3.0) == 2, "");
+    static_assert(remquo_quotient(1.0, -3.0) == 0, "");
+    static_assert(smath::remainder(1.0, 0.0) != smath::remainder(1.0, 0.0), "");
+
+    static_assert(frexp_mantissa(8.0) == 0.5 && frexp_exponent(8.0) == 4, "");
+    static_assert(frexp_mantissa(-0.375) == -0.75 && frexp_exponent(-0.375) == -1, "");
+    static_assert(frexp_exponent(std::numeric_limits<double>::denorm_min()) == -1073, "");
+    static_assert(smath::ldexp(0.75, 4) == 12.0, "");
+    static_assert(smath::ldexp(1.0, -1074) == std::numeric_limits<double>::denorm_min(), "");
+    static_assert(smath::ldexp(1.0, 1024) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::ldexp(-1.0, -1075) == 0.0, "");
+    static_assert(smath::scalbn(3.0f, -2) == 0.75f, "");
+    static_assert(smath::ldexp(1.0, std::numeric_limits<int>::min()) == 0.0, "");
+    static_assert(smath::ldexp(-1.0, std::numeric_limits<int>::max()) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::ldexp(std::numeric_limits<double>::max(), std::numeric_limits<int>::min()) == 0.0, "");
+    static_assert(smath::ldexp(std::numeric_limits<double>::denorm_min(), std::numeric_limits<int>::max()) ==
+                  std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::scalbn(3.0f, std::numeric_limits<int>::min()) == 0.0f, "");
+    static_assert(smath::scalbn(3.0f, std::numeric_limits<int>::max()) == std::numeric_limits<float>::infinity(), "");
+
+    static_assert(smath::ilogb(1.0) == 0, "");
+    static_assert(smath::ilogb(0.75) == -1, "");
+    static_assert(smath::ilogb(1024.5) == 10, "");
+    static_assert(smath::ilogb(std::numeric_limits<double>::denorm_min()) == -1074, "");
+    static_assert(smath::ilogb(0.0) == FP_ILOGB0, "");
+    static_assert(smath::ilogb(std::numeric_limits<double>::quiet_NaN()) == FP_ILOGBNAN, "");
+    static_assert(smath::ilogb(std::numeric_limits<double>::infinity()) == std::numeric_limits<int>::max(), "");
+    static_assert(smath::logb(-12.0) == 3.0, "");
+    static_assert(smath::logb(0.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::logb(-std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity(), "");
+
+    static_assert(smath::nextafter(1.0, 2.0) == 1.0 + std::numeric_limits<double>::epsilon(), "");
+    static_assert(smath::nextafter(1.0, 0.0) == 1.0 - std::numeric_limits<double>::epsilon() / 2, "");
+    static_assert(smath::nextafter(-1.0, 0.0) == -1.0 + std::numeric_limits<double>::epsilon() / 2, "");
+    static_assert(smath::nextafter(1.0f, 2.0f) == 1.0f + std::numeric_limits<float>::epsilon(), "");
+    static_assert(smath::nextafter(0.0, -1.0) == -std::numeric_limits<double>::denorm_min(), "");
+    static_assert(smath::nextafter(std::numeric_limits<double>::denorm_min(), 0.0) == 0.0, "");
+    static_assert(smath::nextafter(std::numeric_limits<double>::min(), 0.0)
+                  == std::numeric_limits<double>::min() - std::numeric_limits<double>::denorm_min(), "");
+    static_assert(smath::nextafter(std::numeric_limits<double>::max(), std::numeric_limits<double>::infinity())
+                  == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::nextafter(std::numeric_limits<double>::infinity(), 0.0)
+                  == std::numeric_limits<double>::max(), "");
+    static_assert(smath::nextafter(2.5, 2.5) == 2.5, "");
+
+    static_assert(smath::copysign(2.0, -1.0) == -2.0, "");
+    static_assert(smath::copysign(-2.0, 1.0) == 2.0, "");
+    static_assert(smath::copysign(-2.0f, 3) == 2.0, "");
+    static_assert(smath::signbit(-3.0), "");
+    static_assert(!smath::signbit(3.0f), "");
+    static_assert(smath::signbit(-std::numeric_limits<double>::infinity()), "");
+
     static_assert(smath::is_close(smath::exp(0.0), 1.0), "");
     static_assert(smath::is_close(smath::exp(1.0), smath::constants::e<>), "");
 
@@ -105,9 +227,63 @@ int main()
     static_assert(smath::is_close(smath::pow(2.0, -1), 0.5), "");
     static_assert(smath::is_close(smath::pow(2.0, -2), 0.25), "");
 
+    static_assert(smath::pow(2.0, 0.0) == 1.0, "");
+    static_assert(smath::pow(1.0, std::numeric_limits<double>::quiet_NaN()) == 1.0, "");
+    static_assert(smath::pow(-8.0, 3.0) == -512.0, "");
+    static_assert(smath::pow(2.0, 0.5) == smath::sqrt(2.0), "");
+    static_assert(smath::is_close(smath::pow(2.0, -1.5), 0.3535533905932737622004221810524245196), "");
+    static_assert(smath::is_close(smath::pow(0.5, 2.4), 0.1894645708137997719575733816928643645), "");
+    static_assert(smath::is_close(smath::pow(0.04045, 0.4166666666666666574), 0.2627540300315659446452138338364973145), "");
+    static_assert(smath::is_close(smath::pow(10.0, -3.25), 0.0005623413251903490803949510397764812315), "");
+    static_assert(smath::is_close(smath::pow(7.5, -0.1), 0.8175115057039068223016478545404608109), "");
+    static_assert(smath::is_close(smath::pow(3.0, 100.5), 8.926600509867260257937586184844912024e+47), "");
+    static_assert(smath::is_close(smath::pow(1.414, 2000.0), 7.921709674702774178181417110253098570e+300), "");
+    static_assert(smath::is_close(smath::pow(0.99, -70000.0), 3.438572388544747216684385909126542814e+305), "");
+    static_assert(smath::is_close(smath::pow(2.0, 1023.5) / 1.271161006153646283660520284222283851e+308, 1.0), "");
+    static_assert(smath::pow(2.0, -1074.0) == std::numeric_limits<double>::denorm_min(), "");
+    static_assert(smath::pow(10.0, 400.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(-10.0, 401.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(10.0, -400.0) == 0.0, "");
+    static_assert(smath::pow(2.0, 1e308) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(0.5, 1e308) == 0.0, "");
+    static_assert(smath::pow(-2.0, -1e308) == 0.0, "");
+    static_assert(!smath::signbit(smath::pow(-2.0, -1e308)), "");
+    static_assert(smath::pow(-1.0, 1e308) == 1.0, "");
+    static_assert(smath::pow(1.0 - std::numeric_limits<double>::epsilon(), 1e30) == 0.0, "");
+    static_assert(smath::pow(2.0f, 1e38f) == std::numeric_limits<float>::infinity(), "");
+    static_assert(smath::pow(-1.0, std::numeric_limits<double>::infinity()) == 1.0, "");
+    static_assert(smath::pow(0.5, -std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(0.0, -1.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(-0.0, -3.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(-std::numeric_limits<double>::infinity(), 3.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::pow(-2.0, 0.5) != smath::pow(-2.0, 0.5), "");
+    static_assert(smath::is_close(smath::pow(0.5f, 2.4f), 0.1894645582894973983289028993867081177f), "");
+    static_assert(smath::is_close(smath::pow(0.5L, 2.4L), 0.1894645708137997602934074751633056548L), "");
+
+    static_assert(smath::cbrt(27.0) == 3.0, "");
+    static_assert(smath::cbrt(-8.0) == -2.0, "");
+    static_assert(smath::cbrt(0.001) == 0.1, "");
+    static_assert(smath::cbrt(1e300) == 1e100, "");
+    static_assert(smath::is_close(smath::cbrt(2.0), 1.259921049894873164767210607278228351), "");
+    static_assert(smath::is_close(smath::cbrt(3.0), 1.442249570307408382321638310780109588), "");
+    static_assert(smath::is_close(smath::cbrt(1e-310), 4.641588833612774165621398953877797401e-104), "");
+    static_assert(smath::cbrt(std::numeric_limits<double>::denorm_min()) == 1.7031839360032603e-108, "");
+    static_assert(smath::is_close(smath::cbrt(2.0f), 1.259921049894873164767210607278228351f), "");
+    static_assert(smath::is_close(smath::cbrt(2.0L), 1.259921049894873164767210607278228351L), "");
+
     static_assert(smath::is_close(smath::sqrt(4.0), 2.0), "");
     static_assert(smath::is_close(smath::sqrt(2.0), 1.414213562373095), "");
     static_assert(smath::is_close(smath::sqrt(3.0), 1.732050807568877), "");
+    static_assert(smath::sqrt(0.25) == 0.5, "");
+    static_assert(smath::sqrt(1e300) == 1e150, "");
+    static_assert(smath::is_close(smath::sqrt(2e-300), 1.4142135623730950488e-150), "");
+    static_assert(smath::is_close(smath::sqrt(5e-324), 2.2227587494850775e-162), "");
+    static_assert(smath::sqrt(0.0) == 0.0, "");
+    static_assert(smath::sqrt(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::sqrt(-1.0) != smath::sqrt(-1.0), "");
+    static_assert(smath::sqrt(std::numeric_limits<double>::quiet_NaN()) != smath::sqrt(std::numeric_limits<double>::quiet_NaN()), "");
+    static_assert(smath::sqrt(1e30f) == 1e15f, "");
+    static_assert(smath::is_close(smath::sqrt(2.0L), 1.41421356237309504880168872420969808L), "");
 
     // From GitHub issue #25
     static_assert(smath::is_close(smath::sqrt(4.916330874e-01f), 0.701165520686806f), "");
@@ -117,6 +293,24 @@ int main()
     static_assert(smath::is_close(smath::sqrt(4.889709353e-01f), 0.699264567456410f), "");
 
     static_assert(smath::is_close(smath::hypot(3.0f, 4), 5.0), "");
+    static_assert(smath::hypot(3.0, 4.0) == 5.0, "");
+    static_assert(smath::hypot(-3.0, 4.0) == 5.0, "");
+    static_assert(smath::hypot(0.0, -0.0) == 0.0, "");
+    static_assert(smath::hypot(2.0, 3.0, 6.0) == 7.0, "");
+    static_assert(smath::hypot(1.0, 2.0, 2.0, 4.0) == 5.0, "");
+    static_assert(smath::hypot(3e30f, 4e30f) == 5e30f, "");
+    static_assert(smath::hypot(3.0L, 4.0L, 12.0L) == 13.0L, "");
+    static_assert(smath::hypot(1.0, 1e-20) == 1.0, "");
+    static_assert(smath::hypot(3e300, 4e300) == 5e300, "");
+    static_assert(smath::hypot(3e-320, 4e-320) == 5e-320, "");
+    static_assert(smath::hypot(1e-200, 1e-300) == 1e-200, "");
+    static_assert(smath::hypot(3e300, 1e-300, 4e300) == 5e300, "");
+    static_assert(smath::is_close(smath::hypot(1e300, 1e300, 1e300, 1e300), 2e300), "");
+    static_assert(smath::hypot(std::numeric_limits<double>::max(), 1.0) == std::numeric_limits<double>::max(), "");
+    static_assert(smath::hypot(std::numeric_limits<double>::max(), std::numeric_limits<double>::max()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::hypot(std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::hypot(1.0, 2.0, -std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::hypot(1.0, std::numeric_limits<double>::quiet_NaN()) != smath::hypot(1.0, std::numeric_limits<double>::quiet_NaN()), "");
 
     static_assert(smath::is_close(smath::exp(-2.0), 0.1353352832366127), "");
     static_assert(smath::is_close(smath::exp(-1.0), 0.36787944117144233), "");
@@ -124,14 +318,195 @@ int main()
     static_assert(smath::is_close(smath::exp(1.0), 2.718281828459045), "");
     static_assert(smath::is_close(smath::exp(2.0), 7.38905609893065), "");
     static_assert(smath::is_close(smath::exp(5.0), 148.4131591025766), "");
+    static_assert(smath::is_close(smath::exp(100.0), 2.688117141816135448412625551580013587361e+43), "");
+    static_assert(smath::is_close(smath::exp(-100.0), 3.720075976020835962959695803863118337359e-44), "");
+    static_assert(smath::is_close(smath::exp(700.0), 1.014232054735004509455329595231267615205e+304), "");
+    static_assert(smath::is_close(smath::exp(-700.0), 9.859676543759770856705372947849465105116e-305), "");
+    static_assert(smath::exp(-740.0) > 0.0, "");
+    static_assert(smath::exp(710.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::exp(-1000.0) == 0.0, "");
+    static_assert(smath::is_close(smath::exp(10.0f), 22026.46579480671651695790064528424436635f), "");
+    static_assert(smath::exp(100.0f) == std::numeric_limits<float>::infinity(), "");
+    static_assert(smath::is_close(smath::exp(-20.0L), 2.061153622438557827965940380155820976376e-9L), "");
+
+    static_assert(smath::exp2(10.0) == 1024.0, "");
+    static_assert(smath::exp2(-3.0) == 0.125, "");
+    static_assert(smath::exp2(-1074.0) == std::numeric_limits<double>::denorm_min(), "");
+    static_assert(smath::is_close(smath::exp2(0.5), 1.414213562373095048801688724209698079), "");
+    static_assert(smath::is_close(smath::exp2(-0.3), 0.8122523963562355288603811233947644757), "");
+    static_assert(smath::is_close(smath::exp2(100.7), 2059304475555603361442221818245.090419), "");
+    static_assert(smath::is_close(smath::exp2(1023.5) / 1.271161006153646283660520284222283851e+308, 1.0), "");
+    static_assert(smath::is_close(smath::exp2(-1070.3), 6.420896076669701185981250390515617460e-323), "");
+    static_assert(smath::exp2(1024.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::exp2(-1100.0) == 0.0, "");
+    static_assert(smath::is_close(smath::exp2(0.3f), 1.231144423517811268957045195167319784f), "");
+    static_assert(smath::is_close(smath::exp2(0.5L), 1.414213562373095048801688724209698079L), "");
+
+    static_assert(smath::exp10(3.0) == 1000.0, "");
+    static_assert(smath::exp10(-2.0) == 0.01, "");
+    static_assert(smath::exp10(22.0) == 1e22, "");
+    static_assert(smath::is_close(smath::exp10(0.5), 3.162277660168379331998893544432718534), "");
+    static_assert(smath::is_close(smath::exp10(-0.3), 0.5011872336272722978138193573445956147), "");
+    static_assert(smath::is_close(smath::exp10(7.25), 17782794.10038922801225421195192684845), "");
+    static_assert(smath::is_close(smath::exp10(308.25) / 1.778279410038922801225421195192684845e+308, 1.0), "");
+    static_assert(smath::is_close(smath::exp10(-310.5), 3.162277660168379331998893544432718534e-311), "");
+    static_assert(smath::exp10(309.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::exp10(-400.0) == 0.0, "");
+    static_assert(smath::is_close(smath::exp10(2.5f), 316.2277660168379331998893544432718534f), "");
+    static_assert(smath::is_close(smath::exp10(0.5L), 3.162277660168379331998893544432718534L), "");
+
+    static_assert(smath::expm1(0.0) == 0.0, "");
+    static_assert(smath::is_close(smath::expm1(1e-10), 1.000000000050000000001666666666708333e-10), "");
+    static_assert(smath::is_close(smath::expm1(-1e-10), -9.99999999950000000001666666666625e-11), "");
+    static_assert(smath::is_close(smath::expm1(0.001), 0.001000500166708341668055753993058311563), "");
+    static_assert(smath::is_close(smath::expm1(-0.3), -0.2591817793182821339331262206821831278), "");
+    static_assert(smath::is_close(smath::expm1(0.5), 0.6487212707001281468486507878141635717), "");
+    static_assert(smath::is_close(smath::expm1(2.0), 6.389056098930650227230427460575007813), "");
+    static_assert(smath::is_close(smath::expm1(-5.0), -0.9932620530009145329033639515768515758), "");
+    static_assert(smath::is_close(smath::expm1(50.0), 5184705528587072464086.453322933485385), "");
+    static_assert(smath::is_close(smath::expm1(700.0), 1.014232054735004509455329595231267615e+304), "");
+    static_assert(smath::expm1(710.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::expm1(-100.0) == -1.0, "");
+    static_assert(smath::is_close(smath::expm1(1e-10f), 1.000000000050000000001666666666708333e-10f), "");
+    static_assert(smath::is_close(smath::expm1(-0.3L), -0.2591817793182821339331262206821831278L), "");
+
+    static_assert(smath::log1p(0.0) == 0.0, "");
+    static_assert(smath::is_close(smath::log1p(1e-10), 9.999999999500000000033333333330833333e-11), "");
+    static_assert(smath::is_close(smath::log1p(-1e-10), -1.000000000050000000003333333333583333e-10), "");
+    static_assert(smath::is_close(smath::log1p(0.001), 0.0009995003330835331668093989205350114608), "");
+    static_assert(smath::is_close(smath::log1p(-0.3), -0.3566749439387323789126387112411844780), "");
+    static_assert(smath::is_close(smath::log1p(0.5), 0.4054651081081643819780131154643491366), "");
+    static_assert(smath::is_close(smath::log1p(2.0), 1.098612288668109691395245236922525705), "");
+    static_assert(smath::is_close(smath::log1p(-0.999), -6.907755278982137052053974364053092623), "");
+    static_assert(smath::is_close(smath::log1p(1e10), 23.02585093004045684017491454684397541), "");
+    static_assert(smath::is_close(smath::log1p(1e300), 690.7755278982137052053974364053092623), "");
+    static_assert(smath::log1p(-1.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::log1p(-2.0) != smath::log1p(-2.0), "");
+    static_assert(smath::is_close(smath::log1p(1e-10f), 9.999999999500000000033333333330833333e-11f), "");
+    static_assert(smath::is_close(smath::log1p(-0.3L), -0.3566749439387323789126387112411844780L), "");
 
     static_assert(smath::log2(256) == 8, "");
     static_assert(smath::log10(100) == 2, "");
+    static_assert(smath::log2(8.0) == 3.0, "");
+    static_assert(smath::log2(0.125) == -3.0, "");
+    static_assert(smath::log2(std::numeric_limits<double>::denorm_min()) == -1074.0, "");
+    static_assert(smath::is_close(smath::log2(0.1), -3.321928094887362267784656834116450249), "");
+    static_assert(smath::is_close(smath::log2(3.0), 1.584962500721156181453738943947816509), "");
+    static_assert(smath::is_close(smath::log2(1e300), 996.5784284662087044368441860900644126), "");
+    static_assert(smath::is_close(smath::log2(0.7071), -0.5000138355781258439260268794309908391), "");
+    static_assert(smath::is_close(smath::log2(1.0000001), 1.442694969596558368209377744607137437e-7), "");
+    static_assert(smath::is_close(smath::log2(0.1f), -3.321928073389531150190563813073839763f), "");
+    static_assert(smath::is_close(smath::log2(3.0L), 1.584962500721156181453738943947816509L), "");
+    static_assert(smath::log2(0.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::log2(-1.0) != smath::log2(-1.0), "");
+    static_assert(smath::log10(1000.0) == 3.0, "");
+    static_assert(smath::log10(0.1) == -1.0, "");
+    static_assert(smath::log10(1e-5) == -5.0, "");
+    static_assert(smath::is_close(smath::log10(2.0), 0.3010299956639811952137388947244930268), "");
+    static_assert(smath::is_close(smath::log10(123456.0), 5.091512201627771681069399777067905795), "");
+    static_assert(smath::is_close(smath::log10(1e300), 300.0000000000000000228025276524884513), "");
+    static_assert(smath::is_close(smath::log10(2.0f), 0.3010299956639811952137388947244930268f), "");
+    static_assert(smath::is_close(smath::log10(2.0L), 0.3010299956639811952137388947244930268L), "");
     static_assert(smath::is_close(smath::log(1.0), 0.0), "");
     static_assert(smath::is_close(smath::log(2.0),    0.693147180559945286226763982995180413126945496), "");
     static_assert(smath::is_close(smath::log(0.5),   -0.693147180559945286226763982995180413126945496), "");
-    static_assert(smath::is_close(smath::log(0.1),   -2.302585084356761679913461193791590631008148193), "");
+    static_assert(smath::is_close(smath::log(0.1),   -2.302585092994045684017991454684364207601101489), "");
     static_assert(smath::is_close(smath::log(256.0),  5.545177444479563177992531564086675643920898438), "");
+    static_assert(smath::is_close(smath::log(1e300),  690.7755278982137052053974364053092622803304466), "");
+    static_assert(smath::is_close(smath::log(1e-300), -690.7755278982137052053974364053092622803304466), "");
+    static_assert(smath::is_close(smath::log(5e-324), -744.4400719213812), "");
+    static_assert(smath::is_close(smath::log(3.0f),   1.098612288668109691395245236922525704647490558f), "");
+    static_assert(smath::is_close(smath::log(1e300L), 690.7755278982137052053974364053092622803304466L), "");
+    static_assert(smath::log(-1.0) != smath::log(-1.0), "");
+    static_assert(smath::log(0.0) == -std::numeric_limits<double>::infinity(), "");
+
+    ////////////////////////////////////////////////////////////
+    // Hyperbolic functions
+
+    static_assert(smath::sinh(0.0) == 0.0, "");
+    static_assert(smath::cosh(0.0) == 1.0, "");
+    static_assert(smath::is_close(smath::sinh(0.5), 0.521095305493747361622425626412), "");
+    static_assert(smath::is_close(smath::cosh(0.5), 1.1276259652063807852262251614), "");
+    static_assert(smath::is_close(smath::sinh(-2.0), -3.6268604078470187676682139828), "");
+    static_assert(smath::is_close(smath::cosh(-2.0), 3.76219569108363145956221347777), "");
+    static_assert(smath::is_close(smath::tanh(0.5), 0.462117157260009758502318483644), "");
+    static_assert(smath::is_close(smath::sinh(20.0), 242582597.704895137953976604052), "");
+    static_assert(smath::is_close(smath::cosh(20.0), 242582597.70489514001513022649), "");
+    static_assert(smath::is_close(smath::sinh(0.5f), 0.521095305493747361622425626412f), "");
+    static_assert(smath::is_close(smath::cosh(0.5L), 1.1276259652063807852262251614L), "");
+    static_assert(smath::is_close(smath::sinh(1e-8), 1.0000000000000000166666666666666667e-8), "");
+    static_assert(smath::is_close(smath::tanh(1e-8), 9.9999999999999996666666666666667e-9), "");
+    static_assert(smath::is_close(smath::tanh(0.1), 0.099667994624955817118305083678352184), "");
+    static_assert(smath::is_close(smath::tanh(2.0), 0.96402758007581688394641372410092315), "");
+    static_assert(smath::is_close(smath::sinh(-30.0), -5343237290762.2310734952342785825860), "");
+    static_assert(smath::is_close(smath::cosh(-30.0), 5343237290762.2310734952343721588157), "");
+    static_assert(smath::is_close(smath::sinh(100.0), 1.3440585709080677242063127757900068e43), "");
+    static_assert(smath::is_close(smath::cosh(710.0) / 1.1169973830808555156268222290584050e308, 1.0), "");
+    static_assert(smath::cosh(711.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::sinh(-711.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::tanh(50.0) == 1.0, "");
+    static_assert(smath::tanh(-1000.0) == -1.0, "");
+    static_assert(smath::is_close(smath::sinh(80.0f), 2.7703111921967550262855866979158306e34f), "");
+    static_assert(smath::sinh(100.0f) == std::numeric_limits<float>::infinity(), "");
+    static_assert(smath::is_close(smath::tanh(9.0f), 0.99999996954004097447930211118358240f), "");
+    static_assert(smath::is_close(smath::sinh(25.0L), 36002449668.692936262073731761130597L), "");
+    static_assert(smath::is_close(smath::tanh(0.1L), 0.099667994624955817118305083678352184L), "");
+
+    ////////////////////////////////////////////////////////////
+    // Error and gamma functions
+
+    static_assert(smath::erf(0.0) == 0.0, "");
+    static_assert(smath::signbit(smath::erf(-0.0)), "");
+    static_assert(smath::is_close(smath::erf(0.5), 0.52049987781304654), "");
+    static_assert(smath::is_close(smath::erf(1.0), 0.84270079294971487), "");
+    static_assert(smath::is_close(smath::erf(-3.0), -0.99997790950300141), "");
+    static_assert(smath::erf(10.0) == 1.0, "");
+    static_assert(smath::erf(-std::numeric_limits<double>::infinity()) == -1.0, "");
+    static_assert(smath::is_close(smath::erf(0.5f), 0.52049987781304654f), "");
+    static_assert(smath::is_close(smath::erf(1.0L), 0.84270079294971486934122063508260926L), "");
+
+    static_assert(smath::erfc(0.0) == 1.0, "");
+    static_assert(smath::is_close(smath::erfc(2.0), 0.0046777349810472658), "");
+    static_assert(smath::is_close(smath::erfc(-1.0), 1.8427007929497149), "");
+    static_assert(smath::is_close(smath::erfc(10.0) / 2.0884875837625448e-45, 1.0), "");
+    static_assert(smath::is_close(smath::erfc(26.0) / 5.6631924088561428e-296, 1.0), "");
+    static_assert(smath::erfc(30.0) == 0.0, "");
+    static_assert(smath::erfc(-30.0) == 2.0, "");
+    static_assert(smath::erfc(std::numeric_limits<double>::infinity()) == 0.0, "");
+    static_assert(smath::is_close(smath::erfc(3.0f) / 2.2090496998585441e-5f, 1.0f), "");
+
+    static_assert(smath::tgamma(1.0) == 1.0, "");
+    static_assert(smath::tgamma(2.0) == 1.0, "");
+    static_assert(smath::tgamma(5.0) == 24.0, "");
+    static_assert(smath::is_close(smath::tgamma(0.5), 1.772453850905516), "");
+    static_assert(smath::is_close(smath::tgamma(-0.5), -3.5449077018110321), "");
+    static_assert(smath::is_close(smath::tgamma(33.3) / 7.4875775965226323e35, 1.0), "");
+    static_assert(smath::is_close(smath::tgamma(171.5) / 9.4833675668247993e307, 1.0), "");
+    static_assert(smath::is_close(smath::tgamma(1e-300) / 1e300, 1.0), "");
+    static_assert(smath::is_close(smath::tgamma(-170.5) / -3.3127395215386073e-308, 1.0), "");
+    static_assert(smath::tgamma(172.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::tgamma(-0.0) == -std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::tgamma(-2.0) != smath::tgamma(-2.0), "");
+    static_assert(smath::tgamma(36.0f) == std::numeric_limits<float>::infinity(), "");
+    static_assert(smath::is_close(smath::tgamma(4.5f), 11.631728396567448f), "");
+
+    static_assert(smath::lgamma(1.0) == 0.0, "");
+    static_assert(smath::lgamma(2.0) == 0.0, "");
+    static_assert(!smath::signbit(smath::lgamma(1.0)), "");
+    static_assert(!smath::signbit(smath::lgamma(2.0)), "");
+    static_assert(!smath::signbit(smath::lgamma(1.0f)), "");
+    static_assert(!smath::signbit(smath::lgamma(2.0L)), "");
+    static_assert(smath::is_close(smath::lgamma(0.5), 0.57236494292470009), "");
+    static_assert(smath::is_close(smath::lgamma(1.5), -0.12078223763524522), "");
+    static_assert(smath::is_close(smath::lgamma(2.5), 0.28468287047291916), "");
+    static_assert(smath::is_close(smath::lgamma(100.0), 359.1342053695754), "");
+    static_assert(smath::is_close(smath::lgamma(-0.5), 1.2655121234846454), "");
+    static_assert(smath::is_close(smath::lgamma(-100.5), -364.90096830942735), "");
+    static_assert(smath::is_close(smath::lgamma(1e300) / 6.8977552789821374e302, 1.0), "");
+    static_assert(smath::lgamma(0.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::lgamma(-3.0) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::lgamma(std::numeric_limits<double>::max()) == std::numeric_limits<double>::infinity(), "");
+    static_assert(smath::is_close(smath::lgamma(0.5L), 0.57236494292470008707171367567652935L), "");
 
     ////////////////////////////////////////////////////////////
     // smath::constant overloads
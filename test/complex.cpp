@@ -138,6 +138,11 @@ int main()
     constexpr auto c3 = 3.0f + 4.0_if;
     static_assert(smath::is_close(smath::norm(c3), 25.0f), "");
     static_assert(smath::is_close(smath::abs(c3), 5.0f), "");
+    static_assert(smath::is_close(smath::arg(c3), 0.92729521f), "");
+
+    constexpr auto c4 = smath::polar(2.0, -2.5);
+    static_assert(smath::is_close(smath::abs(c4), 2.0), "");
+    static_assert(smath::is_close(smath::arg(c4), -2.5), "");
 
     static_assert(smath::conj(comp4) == complex<int>(-2, -4), "");
     static_assert(smath::conj(comp5) == complex<int>(3, 1), "");
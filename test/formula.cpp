@@ -88,8 +88,21 @@ int main()
     static_assert(smath::gcd(3, -6) == 3, "");
     static_assert(smath::gcd(-3, -6) == 3, "");
 
+    static_assert(smath::gcd(smath::euclidean_gcd, 1071, 1029) == 21, "");
+    static_assert(smath::gcd(smath::euclidean_gcd, -3, 6) == 3, "");
+    static_assert(smath::gcd(smath::binary_gcd, 1071, 1029) == 21, "");
+    static_assert(smath::gcd(smath::binary_gcd, 3, -6) == 3, "");
+    static_assert(smath::gcd(48u, 180ul) == 12ul, "");
+    static_assert(smath::gcd(1ll << 62, 3ll << 40) == 1ll << 40, "");
+    static_assert(smath::gcd(7919ull * 104729ull * 64ull, 104729ull * 48ull) == 104729ull * 16ull, "");
+    static_assert(smath::gcd(-2147483647 - 1, 1 << 30) == 1 << 30, "");
+
     static_assert(smath::lcm(60, 168) == 840, "");
     static_assert(smath::lcm(168, 60) == 840, "");
+    static_assert(smath::lcm(smath::euclidean_gcd, 60, 168) == 840, "");
+    static_assert(smath::lcm(smath::binary_gcd, 168, 60) == 840, "");
+    static_assert(smath::lcm(1 << 20, 3 << 10) == 3 << 20, "");
+    static_assert(smath::lcm(2000000000ll * 3, 2000000000ll * 5) == 30000000000ll, "");
 
     static_assert(smath::clamp(3, 2, 4) == 3, "");
     static_assert(smath::clamp(1, 2, 4) == 2, "");
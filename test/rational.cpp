@@ -21,10 +21,24 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  * THE SOFTWARE.
  */
+#include <limits>
+#include <type_traits>
 #include <static_math/rational.h>
 
 using namespace smath;
 
+namespace
+{
+    constexpr auto harmonic(int n)
+        -> rational<long long>
+    {
+        auto res = lazy_rational<long long>(0);
+        for (int i = 1 ; i <= n ; ++i) {
+            res += lazy_rational<long long>(1, i);
+        }
+        return res;
+    }
+}
 
 int main()
 {
@@ -129,4 +143,128 @@ int main()
     static_assert(smath::pow(r1, 0) == 1_r, "");
     static_assert(smath::pow(r2, 1) == r2, "");
     static_assert(smath::pow(r7, 3) == 64 / 125_r, "");
+
+    // Lazy rational construction
+    constexpr auto l1 = lazy_rational<int>(2, 4);
+    static_assert(l1.numer == 2, "");
+    static_assert(l1.denom == 4, "");
+
+    constexpr auto l2 = lazy_rational<int>(1, -3);
+    static_assert(l2.numer == -1, "");
+    static_assert(l2.denom == 3, "");
+
+    constexpr auto l3 = lazy_rational<int>(r7);
+    static_assert(l3.numer == 4, "");
+    static_assert(l3.denom == 5, "");
+
+    // Lazy rational normalization
+    static_assert(lazy_rational<int>(6, -8).normalize().numer == -3, "");
+    static_assert(lazy_rational<int>(6, -8).normalize().denom == 4, "");
+    static_assert(lazy_rational<int>(0, 5).normalize().denom == 1, "");
+    static_assert(rational<int>(l1) == r1, "");
+    static_assert(rational<int>(l1).numer == 1, "");
+
+    // Lazy rational comparison
+    static_assert(l1 == lazy_rational<int>(1, 2), "");
+    static_assert(l1 != l2, "");
+    static_assert(l2 < l1, "");
+    static_assert(l1 > l2, "");
+    static_assert(l1 <= lazy_rational<long>(3, 6), "");
+    static_assert(l3 >= l1, "");
+    static_assert(l1 < 1, "");
+    static_assert(-1 < l2, "");
+    static_assert(lazy_rational<int>(10, 5) == 2, "");
+    static_assert(2 == lazy_rational<int>(10, 5), "");
+
+    // Lazy rational arithmetic operations
+    static_assert((l1 + l1).numer == 4, "");
+    static_assert((l1 + l1).denom == 4, "");
+    static_assert(l1 + l2 == lazy_rational<int>(1, 6), "");
+    static_assert(l1 - l2 == lazy_rational<int>(5, 6), "");
+    static_assert(l1 * l3 == lazy_rational<int>(2, 5), "");
+    static_assert(l1 / l2 == lazy_rational<int>(-3, 2), "");
+    static_assert((l1 / l2).denom > 0, "");
+    static_assert(l1 + 1 == lazy_rational<int>(3, 2), "");
+    static_assert(1 - l1 == l1, "");
+    static_assert(l3 * 5 == 4, "");
+    static_assert(2 / l1 == 4, "");
+    static_assert(-l2 == lazy_rational<int>(1, 3), "");
+
+    // Lazy rational accumulation, the sum would overflow
+    // without the intermediate normalizations
+    static_assert(harmonic(20) == rational<long long>(55835135, 15519504), "");
+
+    // Lazy rational operations whose operands are still too large
+    // for the lazy products once simplified
+    static_assert(lazy_rational<int>(1, 65536) + lazy_rational<int>(1, 131072) == lazy_rational<int>(3, 131072), "");
+    static_assert((lazy_rational<int>(1, 65536) - lazy_rational<int>(1, 131072)).denom == 131072, "");
+    static_assert((lazy_rational<int>(65536, 7) * lazy_rational<int>(7, 65536)).denom == 1, "");
+    static_assert((lazy_rational<int>(65536, 7) * lazy_rational<int>(7, 65536)).numer == 1, "");
+    static_assert((lazy_rational<int>(1, 65536) / lazy_rational<int>(-1, 131072)).numer == -2, "");
+    static_assert((lazy_rational<int>(1, 65536) / lazy_rational<int>(-1, 131072)).denom == 1, "");
+    static_assert(lazy_rational<int>(0, 65536).normalize().denom == 1, "");
+
+    // Lazy rational comparisons of simplified fractions whose cross
+    // products overflow, with and without a wider integer type
+    static_assert(!(lazy_rational<int>(1000000007, 3) < lazy_rational<int>(1000000009, 7)), "");
+    static_assert(lazy_rational<int>(1000000009, 7) < lazy_rational<int>(1000000007, 3), "");
+    static_assert(lazy_rational<int>(-1000000007, 3) < lazy_rational<int>(-1000000009, 7), "");
+    static_assert(lazy_rational<int>(1000000007, 999999999) != lazy_rational<int>(1000000009, 1000000001), "");
+    static_assert(smath::detail::compare_large_fractions(std::false_type{}, 1000000007, 3, 1000000009, 7) == 1, "");
+    static_assert(smath::detail::compare_large_fractions(std::false_type{}, -1000000007, 3, -1000000009, 7) == -1, "");
+    static_assert(smath::detail::compare_large_fractions(std::false_type{}, 2147483646, 2147483647,
+                                                                            2147483645, 2147483646) == 1, "");
+    static_assert(smath::detail::compare_large_fractions(std::false_type{}, 1000000007, 1, 1000000007, 1) == 0, "");
+    static_assert(smath::detail::compare_large_fractions(std::false_type{}, -1, 1000000007, 0, 1) == -1, "");
+
+    // Lazy rational casts
+    static_assert(double(l1) == 0.5, "");
+    static_assert(float(l2) == -1.0f / 3.0f, "");
+    static_assert(bool(l1), "");
+    static_assert(!bool(lazy_rational<int>(0, 3)), "");
+
+    // Lazy rational math functions
+    static_assert(smath::sign(l2) == -1, "");
+    static_assert(smath::abs(l2) == lazy_rational<int>(1, 3), "");
+    static_assert(smath::reciprocal(l2) == -3, "");
+    static_assert(smath::reciprocal(l2).denom == 1, "");
+
+    // Operations whose naive cross products would overflow
+    static_assert(rational<int>(100000, 99999) * rational<int>(99999, 100000) == 1, "");
+    static_assert(rational<int>(1, 100000) + rational<int>(1, 100000) == rational<int>(1, 50000), "");
+    static_assert(rational<int>(3, 100000) - rational<int>(1, 100000) == rational<int>(1, 50000), "");
+    static_assert(rational<int>(100000, 7) / rational<int>(-100000, 3) == rational<int>(-3, 7), "");
+    static_assert((rational<int>(100000, 7) / rational<int>(-100000, 3)).denom == 7, "");
+
+    // Overflow-checked operations
+    constexpr auto int_max = std::numeric_limits<int>::max();
+    static_assert(!checked_add(r1, r3).overflow, "");
+    static_assert(checked_add(r1, r3).value == rational<int>(5, 6), "");
+    static_assert(checked_sub(r1, r3).value == rational<int>(1, 6), "");
+    static_assert(checked_mul(r5, r3).value == rational<int>(-1, 6), "");
+    static_assert(checked_div(r3, r5).value == rational<int>(-2, 3), "");
+    static_assert(!checked_div(r3, r5).overflow, "");
+
+    static_assert(checked_add(rational<int>(int_max), rational<int>(1)).overflow, "");
+    static_assert(checked_sub(rational<int>(-int_max), rational<int>(2)).overflow, "");
+    static_assert(checked_mul(rational<int>(65536), rational<int>(65536)).overflow, "");
+    static_assert(checked_div(rational<int>(1, 65536), rational<int>(65536)).overflow, "");
+    static_assert(checked_add(rational<int>(1, 65536), rational<int>(1, 65537)).overflow, "");
+    static_assert(!checked_add(rational<int>(int_max - 1), rational<int>(1)).overflow, "");
+    static_assert(checked_sub(rational<unsigned>(1, 2), rational<unsigned>(1)).overflow, "");
+    static_assert(!checked_mul(rational<int>(int_max, 2), rational<int>(2, int_max)).overflow, "");
+
+    // Widening operations
+    static_assert(std::is_same<decltype(widening_add(r1, r3)), rational<long long>>::value, "");
+    static_assert(std::is_same<decltype(widening_mul(rational<unsigned short>(1), 1_ru)),
+                               rational<unsigned long long>>::value, "");
+    static_assert(widening_mul(rational<int>(65536), rational<int>(65536)) == rational<long long>(1LL << 32), "");
+    static_assert(widening_add(rational<int>(int_max), rational<int>(int_max)).numer == 2LL * int_max, "");
+    static_assert(widening_sub(rational<int>(1, 65536), rational<int>(1, 65537)) ==
+                  rational<long long>(1, 65536LL * 65537LL), "");
+    static_assert(widening_div(rational<int>(1, 65536), rational<int>(65536)).denom == 1LL << 32, "");
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+    static_assert(widening_mul(rational<long long>(1LL << 62), rational<long long>(2)) ==
+                  widening_add(rational<long long>(std::numeric_limits<long long>::max()), 1_rll), "");
+#endif
 }
@@ -0,0 +1,163 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Morwenn
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <cmath>
+#include <cstdlib>
+#include <static_math/cmath.h>
+#include <static_math/constants.h>
+#include <static_math/table.h>
+
+namespace
+{
+    struct sine
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::sin(x);
+        }
+    };
+
+    struct square_root
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::sqrt(x);
+        }
+    };
+
+    struct exponential
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return smath::exp(x);
+        }
+    };
+
+    struct square
+    {
+        constexpr auto operator()(double x) const
+            -> double
+        {
+            return x * x;
+        }
+    };
+
+    struct cube
+    {
+        constexpr auto operator()(float x) const
+            -> float
+        {
+            return x * x * x;
+        }
+    };
+
+    template<typename T>
+    constexpr auto is_close(T lhs, T rhs)
+        -> bool
+    {
+        return smath::abs(lhs - rhs) <= 1e-5 * smath::abs(rhs) + 1e-15;
+    }
+
+    constexpr auto sine_table = smath::make_table<64>(sine{}, 0.0, smath::constants::pi<double>);
+    constexpr auto sqrt_table = smath::make_table<16>(square_root{}, 0.0, 1.0);
+    constexpr auto exp_table = smath::make_table<8>(exponential{}, 0.0, 8.0);
+    constexpr auto square_table = smath::make_table<5>(square{}, -2.0, 2.0);
+    constexpr auto cube_table = smath::make_table<8>(cube{}, 0.0f, 7.0f);
+
+    // Checks that the interpolation errors stay within the error
+    // bounds all over the table
+    template<typename Table, typename Function>
+    auto within_bounds(const Table& table, Function func)
+        -> bool
+    {
+        bool res = true;
+        for (int i = 0 ; i <= 100000 ; ++i) {
+            const double x = table.lower() + i * ((table.upper() - table.lower()) / 100000);
+            const double expected = func(x);
+            res = res && std::fabs(table.linear(x) - expected) <= table.linear_error();
+            res = res && std::fabs(table.cubic(x) - expected) <= table.cubic_error();
+        }
+        return res;
+    }
+}
+
+int main()
+{
+    ////////////////////////////////////////////////////////////
+    // Layout
+
+    static_assert(alignof(decltype(sine_table)) == 64, "");
+    static_assert(sine_table.size() == 64, "");
+    static_assert(square_table.lower() == -2.0, "");
+    static_assert(square_table.upper() == 2.0, "");
+    static_assert(square_table.step() == 1.0, "");
+
+    ////////////////////////////////////////////////////////////
+    // Sampled values
+
+    static_assert(square_table[0] == 4.0, "");
+    static_assert(square_table[1] == 1.0, "");
+    static_assert(square_table[2] == 0.0, "");
+    static_assert(square_table[4] == 4.0, "");
+    static_assert(square_table.data()[3] == 1.0, "");
+
+    ////////////////////////////////////////////////////////////
+    // Interpolation
+
+    static_assert(square_table(-2.0) == 4.0, "");
+    static_assert(square_table(2.0) == 4.0, "");
+    static_assert(square_table.linear(0.5) == 0.5, "");
+    static_assert(square_table.linear(-1.5) == 2.5, "");
+    static_assert(square_table.linear_error() >= 0.25, "");
+    static_assert(square_table.linear_error() < 0.32, "");
+
+    // Cubic interpolation is exact for polynomials of degree 3
+    static_assert(is_close(square_table.cubic(0.5), 0.25), "");
+    static_assert(is_close(square_table.cubic(-1.5), 2.25), "");
+    static_assert(is_close(square_table.cubic(1.75), 3.0625), "");
+    static_assert(square_table.cubic_error() < 1e-14, "");
+    static_assert(is_close(cube_table.cubic(2.5f), 15.625f), "");
+    static_assert(is_close(cube_table.cubic(6.5f), 274.625f), "");
+
+    // Out of range arguments are clamped
+    static_assert(square_table(-8.0) == 4.0, "");
+    static_assert(is_close(square_table.cubic(8.0), 4.0), "");
+
+    ////////////////////////////////////////////////////////////
+    // Error bounds
+
+    static_assert(sine_table.linear_error() < 1e-3, "");
+    static_assert(sine_table.cubic_error() < 1e-5, "");
+    static_assert(sine_table.cubic_error() < sine_table.linear_error(), "");
+
+    // The largest errors of the edge intervals and of functions
+    // with large derivatives aren't in the middle of the intervals
+    bool res = within_bounds(sine_table, sine{});
+    res = res && within_bounds(sqrt_table, square_root{});
+    res = res && within_bounds(exp_table, exponential{});
+    res = res && within_bounds(square_table, square{});
+    return res ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -25,7 +25,9 @@
 /*
 * This file is the work of theLOLflashlight's GitHub account.
 */
+#include <limits>
 #include <static_math/constants.h>
+#include <static_math/formula.h>
 #include <static_math/trigonometry.h>
 
 int main()
@@ -34,5 +36,99 @@ int main()
 
     // TODO: make this more exhaustive.
     static_assert(smath::sin(constants::pi<> / 2) == 1, "");
-    static_assert(smath::cos(constants::pi<> / 2) == 0, "");
+    // pi<> / 2 is slightly lesser than the real pi/2
+    static_assert(smath::is_close(smath::cos(constants::pi<> / 2), 6.123233995736766e-17), "");
+
+    static_assert(smath::sin(0.0) == 0.0, "");
+    static_assert(smath::cos(0.0) == 1.0, "");
+    static_assert(smath::is_close(smath::sin(1.0), 0.8414709848078965), "");
+    static_assert(smath::is_close(smath::cos(1.0), 0.5403023058681398), "");
+    static_assert(smath::is_close(smath::sin(-10.0), 0.5440211108893698), "");
+    static_assert(smath::is_close(smath::cos(100.0), 0.8623188722876839), "");
+    static_assert(smath::is_close(smath::sin(1.0f), 0.84147098f), "");
+    static_assert(smath::is_close(smath::cos(1.0L), 0.540302305868139717400936607442976603732L), "");
+
+    // Large arguments
+    static_assert(smath::is_close(smath::sin(1.0e6), -0.34999350217129294), "");
+    static_assert(smath::is_close(smath::sin(1.0e22), -0.8522008497671888), "");
+    static_assert(smath::is_close(smath::cos(1.0e22), 0.5232147853951389), "");
+    static_assert(smath::is_close(smath::sin(1.0e300), -0.8178819121159085), "");
+
+    // sincos shares the reduction but gives the same results
+    static_assert(smath::sincos(1.0).sin == smath::sin(1.0), "");
+    static_assert(smath::sincos(1.0).cos == smath::cos(1.0), "");
+    static_assert(smath::sincos(-10.0).sin == smath::sin(-10.0), "");
+    static_assert(smath::sincos(-10.0).cos == smath::cos(-10.0), "");
+    static_assert(smath::sincos(1.0e22).sin == smath::sin(1.0e22), "");
+    static_assert(smath::sincos(1.0e22).cos == smath::cos(1.0e22), "");
+    static_assert(smath::sincos(2.5f).sin == smath::sin(2.5f), "");
+    static_assert(smath::sincos(4.0L).cos == smath::cos(4.0L), "");
+    static_assert(smath::sincos(0.0).sin == 0.0 && smath::sincos(0.0).cos == 1.0, "");
+
+    static_assert(smath::is_close(smath::tan(1.0), 1.5574077246549023), "");
+    static_assert(smath::is_close(smath::tan(-2.0), 2.185039863261519), "");
+    static_assert(smath::is_close(smath::cot(1.0), 0.6420926159343306), "");
+    static_assert(smath::is_close(smath::sec(1.0), 1.8508157176809255), "");
+    static_assert(smath::is_close(smath::csc(1.0), 1.1883951057781212), "");
+
+    // Inverse functions
+    static_assert(smath::asin(0.0) == 0.0, "");
+    static_assert(smath::asin(1.0) == constants::pi<> / 2, "");
+    static_assert(smath::asin(-1.0) == -constants::pi<> / 2, "");
+    static_assert(smath::is_close(smath::asin(0.25), 0.25268025514207865), "");
+    static_assert(smath::is_close(smath::asin(-0.75), -0.848062078981481), "");
+    static_assert(smath::is_close(smath::asin(0.999), 1.526071239626163), "");
+    static_assert(smath::is_close(smath::asin(0.5f), 0.52359877f), "");
+    static_assert(smath::is_close(smath::asin(0.8L), 0.927295218001612232428512462922428804L), "");
+    static_assert(smath::asin(1.5) != smath::asin(1.5), "");
+
+    static_assert(smath::acos(1.0) == 0.0, "");
+    static_assert(smath::acos(-1.0) == constants::pi<>, "");
+    static_assert(smath::acos(0.0) == constants::pi<> / 2, "");
+    static_assert(smath::is_close(smath::acos(0.25), 1.318116071652818), "");
+    static_assert(smath::is_close(smath::acos(0.75), 0.7227342478134157), "");
+    static_assert(smath::is_close(smath::acos(-0.75), 2.4188584057763776), "");
+    static_assert(smath::is_close(smath::acos(-0.2f), 1.7721543f), "");
+    static_assert(smath::acos(-2.0) != smath::acos(-2.0), "");
+
+    static_assert(smath::atan(0.0) == 0.0, "");
+    static_assert(smath::atan(1.0) == constants::pi<> / 4, "");
+    static_assert(smath::is_close(smath::atan(0.3), 0.2914567944778671), "");
+    static_assert(smath::is_close(smath::atan(0.6), 0.5404195002705842), "");
+    static_assert(smath::is_close(smath::atan(-1.3), -0.9151007005533605), "");
+    static_assert(smath::is_close(smath::atan(2.0), 1.1071487177940904), "");
+    static_assert(smath::is_close(smath::atan(1.0e10), 1.5707963266948965), "");
+    static_assert(smath::atan(std::numeric_limits<double>::infinity()) == constants::pi<> / 2, "");
+    static_assert(smath::is_close(smath::atan(4.0f), 1.3258177f), "");
+    static_assert(smath::is_close(smath::atan(0.5L), 0.463647609000806116214256231461214402L), "");
+
+    static_assert(smath::is_close(smath::atan2(1.0, 2.0), 0.4636476090008061), "");
+    static_assert(smath::is_close(smath::atan2(1.0, -2.0), 2.677945044588987), "");
+    static_assert(smath::is_close(smath::atan2(-1.0, -2.0), -2.677945044588987), "");
+    static_assert(smath::is_close(smath::atan2(-3.0f, 1.0f), -1.2490458f), "");
+    static_assert(smath::atan2(1, 0) == constants::pi<> / 2, "");
+    static_assert(smath::atan2(0.0, -1.0) == constants::pi<>, "");
+    static_assert(smath::atan2(-0.0, -1.0) == -constants::pi<>, "");
+    static_assert(smath::atan2(0.0, 1.0) == 0.0, "");
+    static_assert(smath::atan2(1.0, -std::numeric_limits<double>::infinity()) == constants::pi<>, "");
+    static_assert(smath::atan2(std::numeric_limits<double>::infinity(),
+                               std::numeric_limits<double>::infinity()) == constants::pi<> / 4, "");
+
+    // Hyperbolic functions
+    static_assert(smath::is_close(smath::sinhcosh(0.5).sinh, 0.5210953054937474), "");
+    static_assert(smath::is_close(smath::sinhcosh(0.5).cosh, 1.1276259652063807), "");
+    static_assert(smath::is_close(smath::sinhcosh(-3.0).sinh, -10.017874927409903), "");
+    static_assert(smath::is_close(smath::sinhcosh(-3.0).cosh, 10.067661995777765), "");
+    static_assert(smath::sinhcosh(0.0).sinh == 0.0 && smath::sinhcosh(0.0).cosh == 1.0, "");
+    static_assert(smath::sinhcosh(25.0).sinh == smath::sinh(25.0), "");
+    static_assert(smath::sinhcosh(25.0).cosh == smath::cosh(25.0), "");
+    static_assert(smath::sinhcosh(-0.3).sinh == smath::sinh(-0.3), "");
+    static_assert(smath::sinhcosh(-0.3).cosh == smath::cosh(-0.3), "");
+    static_assert(smath::is_close(smath::tanh(-1.0), -0.7615941559557649), "");
+    static_assert(smath::is_close(smath::coth(2.0), 1.0373147207275481), "");
+    static_assert(smath::coth(1000.0) == 1.0, "");
+    static_assert(smath::coth(-800.0) == -1.0, "");
+    static_assert(smath::coth(1e300) == 1.0, "");
+    static_assert(smath::is_close(smath::sech(2.0), 0.2658022288340797), "");
+    static_assert(smath::is_close(smath::csch(2.0), 0.27572056477178325), "");
 }
@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# The MIT License (MIT)
+#
+# Copyright (c) 2019 Morwenn
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""
+Generates the minimax coefficients found in include/static_math/detail/minimax.h
+
+Every kernel approximates a function g(z) on an interval [a, b] with a
+polynomial P(z) which minimizes the maximal weighted error w(z)(P(z) - g(z)),
+thanks to the Remez exchange algorithm. The coefficients are then rounded to
+the precision of the target type. Requires mpmath.
+
+Usage: python3 tools/minimax.py [kernel...]
+"""
+
+import sys
+from mpmath import mp, mpf, matrix, lu_solve, nstr, ldexp, frexp, nint, cos, sin, coth, exp, erfc, gamma, loggamma, euler, log
+
+mp.prec = 320
+
+# Precision of the target types and the C++ type used to store the
+# coefficients: float kernels are evaluated in double
+TARGETS = [
+    (24, 'double', ''),
+    (53, 'double', ''),
+    (64, 'long double', 'L'),
+    (113, 'long double', 'L'),
+]
+
+PI = mp.pi
+LN2 = mp.ln2
+
+def series(coeff, z, terms=400):
+    """Sums coeff(k) * z^k until it converges"""
+    res = mpf(0)
+    power = mpf(1)
+    for k in range(terms):
+        term = coeff(k) * power
+        res += term
+        if term != 0 and abs(term) < abs(res) * mpf(2) ** (-mp.prec):
+            break
+        power *= z
+    return res
+
+def fac(n):
+    return mp.factorial(n)
+
+def erfcx(x):
+    return exp(x * x) * erfc(x)
+
+def gamma_ratio(x):
+    """(gamma(1+x) - 1) / (x (x-1)), extended by continuity at 0 and 1"""
+    if x == 0:
+        return +euler
+    if x == 1:
+        return 1 - euler
+    return (gamma(1 + x) - 1) / (x * (x - 1))
+
+def stirling_tail(z):
+    """x (lgamma(x) - (x-1/2) log(x) + x - log(2 pi)/2) with x = 1/sqrt(z)"""
+    x = 1 / mp.sqrt(z)
+    return (loggamma(x) - ((x - mpf(0.5)) * log(x) - x + log(2 * PI) / 2)) * x
+
+# Kernels: name -> (g, weight, interval, description)
+#   sin(x) = x + x^3 P(x^2), relative error
+#   cos(x) = 1 - x^2/2 + x^4 P(x^2), relative error
+#   log(1+f) = 2s + s^3 P(s^2) with s = f/(2+f), relative error
+#   r coth(r/2) = 2 + r^2 P(r^2), relative error of exp(r) = 1 + 2r/(r coth(r/2) - r)
+#   R1(h) = 6/r (coth(r/2) - 2/r) = 1 + h P(h) with h = r^2/2, absolute error
+#   atan(x) = x + x^3 P(x^2), relative error
+#   asin(x) = x + x^3 P(x^2), relative error
+#   erf(x) = x + x P(x^2), relative error
+#   exp(x^2) erfc(x) = P(x - c) on two intervals, relative error
+#   x exp(x^2) erfc(x) = P(1/x^2), relative error
+#   gamma(3/2+t) = 1 + (t+1/2) (t-1/2) P(t), relative error of gamma(3/2+t) - 1
+#   lgamma(x) = (x-1/2) log(x) - x + log(2 pi)/2 + P(1/x^2)/x, absolute error
+KERNELS = {
+    'sin': (
+        lambda z: series(lambda k: (-1) ** (k + 1) / fac(2 * k + 3), z),
+        lambda z: z * mp.sqrt(z) / sin(mp.sqrt(z)),
+        ((PI / 4) ** 2 / 2 ** 16, (PI / 4) ** 2),
+        'sin(x) = x + x^3 P(x^2) on [-pi/4, pi/4]',
+    ),
+    'cos': (
+        lambda z: series(lambda k: (-1) ** k / fac(2 * k + 4), z),
+        lambda z: z * z / cos(mp.sqrt(z)),
+        ((PI / 4) ** 2 / 2 ** 16, (PI / 4) ** 2),
+        'cos(x) = 1 - x^2/2 + x^4 P(x^2) on [-pi/4, pi/4]',
+    ),
+    'log': (
+        lambda z: series(lambda k: mpf(2) / (2 * k + 3), z),
+        lambda z: z * mp.sqrt(z) / mp.atanh(mp.sqrt(z)) / 2,
+        (mpf(0.171572875253809902396622551580603842) ** 2 / 2 ** 16,
+         mpf(0.171572875253809902396622551580603842) ** 2),
+        'log(1+f) = 2s + s^3 P(s^2) with s = f/(2+f) on [sqrt(1/2)-1, sqrt(2)-1]',
+    ),
+    'exp': (
+        lambda z: (mp.sqrt(z) * coth(mp.sqrt(z) / 2) - 2) / z,
+        lambda z: z * mp.sqrt(z) * exp(mp.sqrt(z)) / 2,
+        ((LN2 / 2) ** 2 / 2 ** 16, (LN2 / 2) ** 2),
+        'r coth(r/2) = 2 + r^2 P(r^2) on [-ln(2)/2, ln(2)/2]',
+    ),
+    'expm1': (
+        lambda h: (6 / mp.sqrt(2 * h) * (coth(mp.sqrt(2 * h) / 2) - 2 / mp.sqrt(2 * h)) - 1) / h,
+        lambda h: h,
+        ((LN2 / 2) ** 2 / 2 / 2 ** 16, (LN2 / 2) ** 2 / 2),
+        'R1(h) = 6/r (coth(r/2) - 2/r) = 1 + h P(h) with h = r^2/2 on [-ln(2)/2, ln(2)/2]',
+    ),
+    'atan': (
+        lambda z: series(lambda k: mpf((-1) ** (k + 1)) / (2 * k + 3), z),
+        lambda z: z * mp.sqrt(z) / mp.atan(mp.sqrt(z)),
+        ((mpf(7) / 16) ** 2 / 2 ** 16, (mpf(7) / 16) ** 2),
+        'atan(x) = x + x^3 P(x^2) on [-7/16, 7/16]',
+    ),
+    'asin': (
+        lambda z: series(lambda k: fac(2 * k + 2) / (4 ** (k + 1) * fac(k + 1) ** 2 * (2 * k + 3)), z),
+        lambda z: z * mp.sqrt(z) / mp.asin(mp.sqrt(z)),
+        (mpf(0.25) / 2 ** 16, mpf(0.25)),
+        'asin(x) = x + x^3 P(x^2) on [-1/2, 1/2]',
+    ),
+    'erf': (
+        lambda z: series(lambda k: 2 / mp.sqrt(PI) * (-1) ** k / (fac(k) * (2 * k + 1)), z) - 1,
+        lambda z: 1 / series(lambda k: 2 / mp.sqrt(PI) * (-1) ** k / (fac(k) * (2 * k + 1)), z),
+        (mpf(0.25) / 2 ** 16, mpf(0.25)),
+        'erf(x) = x + x P(x^2) on [-1/2, 1/2]',
+    ),
+    'erfcx_near': (
+        lambda t: erfcx(1 + t),
+        lambda t: 1 / erfcx(1 + t),
+        (mpf(-0.5), mpf(0.5)),
+        'exp(x^2) erfc(x) = P(x - 1) on [1/2, 3/2]',
+    ),
+    'erfcx_mid': (
+        lambda t: erfcx(mpf(2.25) + t),
+        lambda t: 1 / erfcx(mpf(2.25) + t),
+        (mpf(-0.75), mpf(0.75)),
+        'exp(x^2) erfc(x) = P(x - 9/4) on [3/2, 3]',
+    ),
+    'erfcx_far': (
+        lambda z: erfcx(1 / mp.sqrt(z)) / mp.sqrt(z),
+        lambda z: mp.sqrt(z) / erfcx(1 / mp.sqrt(z)),
+        (mpf(1) / 9 / 2 ** 16, mpf(1) / 9),
+        'x exp(x^2) erfc(x) = P(1/x^2) on [3, inf)',
+    ),
+    'gamma': (
+        lambda t: gamma_ratio(t + mpf(0.5)),
+        lambda t: 1 / gamma_ratio(t + mpf(0.5)),
+        (mpf(-0.5), mpf(0.5)),
+        'gamma(3/2+t) = 1 + (t+1/2) (t-1/2) P(t) on [-1/2, 1/2]',
+    ),
+    'lgamma': (
+        stirling_tail,
+        lambda z: mp.sqrt(z),
+        (mpf(1) / 144 / 2 ** 16, mpf(1) / 144),
+        'lgamma(x) = (x-1/2) log(x) - x + log(2 pi)/2 + P(1/x^2)/x on [12, inf)',
+    ),
+}
+
+def remez(g, w, a, b, n, iterations=40):
+    """Minimax polynomial with n coefficients for g with weight w on [a, b]"""
+    def error(coeffs, x):
+        return w(x) * (poly(coeffs, x) - g(x))
+
+    # Dense grid used to locate the extrema of the error
+    samples = 50 * (n + 1)
+    grid = [a + (b - a) * (1 - mp.cos(PI * i / samples)) / 2 for i in range(samples + 1)]
+    gs = [g(x) for x in grid]
+    ws = [w(x) for x in grid]
+
+    # Initial reference: Chebyshev extrema
+    ref = [a + (b - a) * (1 - mp.cos(PI * i / n)) / 2 for i in range(n + 1)]
+    coeffs, err, previous = None, None, None
+    for _ in range(iterations):
+        # Solve w(x_i) (P(x_i) - g(x_i)) = (-1)^i E
+        m = matrix(n + 1, n + 1)
+        rhs = matrix(n + 1, 1)
+        for i, x in enumerate(ref):
+            wx = w(x)
+            for j in range(n):
+                m[i, j] = wx * x ** j
+            m[i, n] = -(-1) ** i
+            rhs[i] = wx * g(x)
+        sol = lu_solve(m, rhs)
+        coeffs = [sol[j] for j in range(n)]
+
+        es = [ws[i] * (poly(coeffs, x) - gs[i]) for i, x in enumerate(grid)]
+        err = max(abs(e) for e in es)
+        if previous is not None and abs(err - previous) <= err * mpf(2) ** -20:
+            break
+        previous = err
+
+        # Keep the greatest alternating local extrema of the error
+        extrema = []
+        for i in range(len(grid)):
+            e = es[i]
+            if (i == 0 or abs(e) >= abs(es[i - 1])) and (i == len(grid) - 1 or abs(e) >= abs(es[i + 1])):
+                if extrema and (extrema[-1][1] > 0) == (e > 0):
+                    if abs(e) > abs(extrema[-1][1]):
+                        extrema[-1] = (grid[i], e)
+                else:
+                    extrema.append((grid[i], e))
+        while len(extrema) > n + 1:
+            if abs(extrema[0][1]) < abs(extrema[-1][1]):
+                extrema.pop(0)
+            else:
+                extrema.pop()
+        if len(extrema) < n + 1:
+            break
+        ref = [x for x, _ in extrema]
+    return coeffs, err
+
+def poly(coeffs, x):
+    res = mpf(0)
+    for c in reversed(coeffs):
+        res = res * x + c
+    return res
+
+def round_to(x, digits):
+    if x == 0:
+        return x
+    m, e = frexp(x)
+    return ldexp(nint(ldexp(m, digits)), e - digits)
+
+def generate(name):
+    g, w, (a, b), description = KERNELS[name]
+    print()
+    print('    ////////////////////////////////////////////////////////////')
+    print('    // %s' % description)
+    print()
+    print('    template<int Digits>')
+    print('    struct %s_minimax;' % name)
+    for digits, ctype, suffix in TARGETS:
+        # Smallest number of coefficients reaching the precision
+        for n in range(1, 60):
+            coeffs, err = remez(g, w, a, b, n)
+            if err < mpf(2) ** -(digits + 3):
+                break
+        storage = 53 if ctype == 'double' else digits
+        precision = 40 if storage > 64 else 21 if storage > 53 else 17
+        print()
+        print('    template<>')
+        print('    struct %s_minimax<%d>' % (name, digits))
+        print('    {')
+        print('        // %d coefficients, max relative error 2^%s' % (n, nstr(mp.log(err, 2), 4)))
+        print('        static constexpr auto coefficients()')
+        print('            -> polynomial<%s, %d>' % (ctype, n))
+        print('        {')
+        print('            return {{')
+        for c in coeffs:
+            c = round_to(c, storage)
+            print('                %s%s,' % (nstr(c, precision, min_fixed=0, max_fixed=0), suffix))
+        print('            }};')
+        print('        }')
+        print('    };')
+
+if __name__ == '__main__':
+    for kernel in (sys.argv[1:] or sorted(KERNELS)):
+        generate(kernel)